@@ -0,0 +1,201 @@
+#include "bitmap.h"
+#include <stdlib.h>
+#include <string.h>
+
+void runBitmapInit(RunBitmap *bitmap, int lines, int length) {
+    bitmap->LINES = lines;
+    bitmap->LENGTH = length;
+    bitmap->LINE = calloc(lines, sizeof(RunLine));
+}
+
+void runBitmapFree(RunBitmap *bitmap) {
+    for (int x = 0; x < bitmap->LINES; x++) {
+        free(bitmap->LINE[x].RUNS);
+    }
+    free(bitmap->LINE);
+    bitmap->LINE = NULL;
+}
+
+void runBitmapClearAll(RunBitmap *bitmap) {
+    for (int x = 0; x < bitmap->LINES; x++) {
+        bitmap->LINE[x].COUNT = 0;
+    }
+}
+
+// First run whose end is >= y, so a run ending exactly at y is still found
+// and can be merged with a span starting there.
+static int findRun(const RunLine *line, int y) {
+    int lo = 0, hi = line->COUNT;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if (line->RUNS[mid * 2 + 1] < y) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void reserveRuns(RunLine *line, int count) {
+    if (count <= line->CAPACITY) {
+        return;
+    }
+    int capacity = line->CAPACITY ? line->CAPACITY * 2 : 4;
+    while (capacity < count) {
+        capacity *= 2;
+    }
+    line->RUNS = realloc(line->RUNS, capacity * 2 * sizeof(int));
+    line->CAPACITY = capacity;
+}
+
+bool runBitmapTest(const RunBitmap *bitmap, int x, int y) {
+    const RunLine *line = &bitmap->LINE[x];
+    int i = findRun(line, y + 1);
+    return i < line->COUNT && line->RUNS[i * 2] <= y;
+}
+
+void runBitmapSet(RunBitmap *bitmap, int x, int y) {
+    runBitmapSetRange(bitmap, x, y, y + 1);
+}
+
+void runBitmapSetRange(RunBitmap *bitmap, int x, int start, int end) {
+    if (start >= end) {
+        return;
+    }
+    RunLine *line = &bitmap->LINE[x];
+    int first = findRun(line, start);
+    int last = first;
+    while (last < line->COUNT && line->RUNS[last * 2] <= end) {
+        last++;
+    }
+
+    if (first == last) {
+        reserveRuns(line, line->COUNT + 1);
+        memmove(&line->RUNS[(first + 1) * 2], &line->RUNS[first * 2], (line->COUNT - first) * 2 * sizeof(int));
+        line->RUNS[first * 2] = start;
+        line->RUNS[first * 2 + 1] = end;
+        line->COUNT += 1;
+        return;
+    }
+
+    if (line->RUNS[first * 2] < start) {
+        start = line->RUNS[first * 2];
+    }
+    if (line->RUNS[(last - 1) * 2 + 1] > end) {
+        end = line->RUNS[(last - 1) * 2 + 1];
+    }
+    line->RUNS[first * 2] = start;
+    line->RUNS[first * 2 + 1] = end;
+    memmove(&line->RUNS[(first + 1) * 2], &line->RUNS[last * 2], (line->COUNT - last) * 2 * sizeof(int));
+    line->COUNT -= last - first - 1;
+}
+
+void runBitmapReset(RunBitmap *bitmap, int x, int y) {
+    RunLine *line = &bitmap->LINE[x];
+    int i = findRun(line, y + 1);
+    if (i >= line->COUNT || line->RUNS[i * 2] > y) {
+        return;
+    }
+
+    int start = line->RUNS[i * 2];
+    int end = line->RUNS[i * 2 + 1];
+    if (start == y && end == y + 1) {
+        memmove(&line->RUNS[i * 2], &line->RUNS[(i + 1) * 2], (line->COUNT - i - 1) * 2 * sizeof(int));
+        line->COUNT -= 1;
+    } else if (start == y) {
+        line->RUNS[i * 2] = y + 1;
+    } else if (end == y + 1) {
+        line->RUNS[i * 2 + 1] = y;
+    } else {
+        reserveRuns(line, line->COUNT + 1);
+        memmove(&line->RUNS[(i + 1) * 2], &line->RUNS[i * 2], (line->COUNT - i) * 2 * sizeof(int));
+        line->RUNS[i * 2 + 1] = y;
+        line->RUNS[(i + 1) * 2] = y + 1;
+        line->COUNT += 1;
+    }
+}
+
+long runBitmapCount(const RunBitmap *bitmap) {
+    long count = 0;
+    for (int x = 0; x < bitmap->LINES; x++) {
+        const RunLine *line = &bitmap->LINE[x];
+        for (int i = 0; i < line->COUNT; i++) {
+            count += line->RUNS[i * 2 + 1] - line->RUNS[i * 2];
+        }
+    }
+    return count;
+}
+
+size_t runBitmapBytes(const RunBitmap *bitmap) {
+    size_t bytes = sizeof(RunBitmap) + bitmap->LINES * sizeof(RunLine);
+    for (int x = 0; x < bitmap->LINES; x++) {
+        bytes += bitmap->LINE[x].CAPACITY * 2 * sizeof(int);
+    }
+    return bytes;
+}
+
+void denseBitmapInit(DenseBitmap *bitmap, int lines, int length) {
+    bitmap->LINES = lines;
+    bitmap->LENGTH = length;
+    bitmap->WORDS_PER_LINE = (length + 63) / 64;
+    bitmap->WORDS = calloc((size_t) lines * bitmap->WORDS_PER_LINE, sizeof(uint64_t));
+}
+
+void denseBitmapFree(DenseBitmap *bitmap) {
+    free(bitmap->WORDS);
+    bitmap->WORDS = NULL;
+}
+
+void denseBitmapClearAll(DenseBitmap *bitmap) {
+    memset(bitmap->WORDS, 0, (size_t) bitmap->LINES * bitmap->WORDS_PER_LINE * sizeof(uint64_t));
+}
+
+bool denseBitmapTest(const DenseBitmap *bitmap, int x, int y) {
+    const uint64_t *line = &bitmap->WORDS[(size_t) x * bitmap->WORDS_PER_LINE];
+    return (line[y >> 6] >> (y & 63)) & 1;
+}
+
+void denseBitmapSet(DenseBitmap *bitmap, int x, int y) {
+    uint64_t *line = &bitmap->WORDS[(size_t) x * bitmap->WORDS_PER_LINE];
+    line[y >> 6] |= (uint64_t) 1 << (y & 63);
+}
+
+void denseBitmapSetRange(DenseBitmap *bitmap, int x, int start, int end) {
+    if (start >= end) {
+        return;
+    }
+    uint64_t *line = &bitmap->WORDS[(size_t) x * bitmap->WORDS_PER_LINE];
+    int first = start >> 6;
+    int last = (end - 1) >> 6;
+    uint64_t headMask = ~(uint64_t) 0 << (start & 63);
+    uint64_t tailMask = ~(uint64_t) 0 >> (63 - ((end - 1) & 63));
+
+    if (first == last) {
+        line[first] |= headMask & tailMask;
+        return;
+    }
+    line[first] |= headMask;
+    for (int w = first + 1; w < last; w++) {
+        line[w] = ~(uint64_t) 0;
+    }
+    line[last] |= tailMask;
+}
+
+void denseBitmapReset(DenseBitmap *bitmap, int x, int y) {
+    uint64_t *line = &bitmap->WORDS[(size_t) x * bitmap->WORDS_PER_LINE];
+    line[y >> 6] &= ~((uint64_t) 1 << (y & 63));
+}
+
+long denseBitmapCount(const DenseBitmap *bitmap) {
+    long count = 0;
+    size_t words = (size_t) bitmap->LINES * bitmap->WORDS_PER_LINE;
+    for (size_t w = 0; w < words; w++) {
+        count += __builtin_popcountll(bitmap->WORDS[w]);
+    }
+    return count;
+}
+
+size_t denseBitmapBytes(const DenseBitmap *bitmap) {
+    return sizeof(DenseBitmap) + (size_t) bitmap->LINES * bitmap->WORDS_PER_LINE * sizeof(uint64_t);
+}
@@ -0,0 +1,50 @@
+#ifndef BITMAP_H
+#define BITMAP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Layers are stored per board column (x) so that a line runs along y, the
+// same direction board[x][y] is laid out in memory.
+
+typedef struct RunLine {
+    int COUNT;
+    int CAPACITY;
+    int *RUNS;          // COUNT sorted, disjoint [start, end) pairs
+} RunLine;
+
+typedef struct RunBitmap {
+    int LINES;
+    int LENGTH;
+    RunLine *LINE;
+} RunBitmap;
+
+typedef struct DenseBitmap {
+    int LINES;
+    int LENGTH;
+    int WORDS_PER_LINE;
+    uint64_t *WORDS;
+} DenseBitmap;
+
+void runBitmapInit(RunBitmap *bitmap, int lines, int length);
+void runBitmapFree(RunBitmap *bitmap);
+void runBitmapClearAll(RunBitmap *bitmap);
+bool runBitmapTest(const RunBitmap *bitmap, int x, int y);
+void runBitmapSet(RunBitmap *bitmap, int x, int y);
+void runBitmapSetRange(RunBitmap *bitmap, int x, int start, int end);
+void runBitmapReset(RunBitmap *bitmap, int x, int y);
+long runBitmapCount(const RunBitmap *bitmap);
+size_t runBitmapBytes(const RunBitmap *bitmap);
+
+void denseBitmapInit(DenseBitmap *bitmap, int lines, int length);
+void denseBitmapFree(DenseBitmap *bitmap);
+void denseBitmapClearAll(DenseBitmap *bitmap);
+bool denseBitmapTest(const DenseBitmap *bitmap, int x, int y);
+void denseBitmapSet(DenseBitmap *bitmap, int x, int y);
+void denseBitmapSetRange(DenseBitmap *bitmap, int x, int start, int end);
+void denseBitmapReset(DenseBitmap *bitmap, int x, int y);
+long denseBitmapCount(const DenseBitmap *bitmap);
+size_t denseBitmapBytes(const DenseBitmap *bitmap);
+
+#endif
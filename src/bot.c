@@ -0,0 +1,198 @@
+#include "bot.h"
+#include <stdlib.h>
+#include <time.h>
+#include "noguess.h"
+#include "rng.h"
+
+static double botClock(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+void botInit(Bot *bot, Status status) {
+    bot->STATUS = status;
+    bot->BOARD = allocBoard(status.W_TILES, status.H_TILES);
+    bot->CELLS = malloc(status.W_TILES * status.H_TILES * sizeof(int));
+    solverInit(&bot->SOLVER, status);
+    probabilityInit(&bot->PROBABILITY, status);
+    probabilityCacheInit(&bot->CACHE, 256, 4 << 20);
+    bot->PROBABILITY.CACHE = &bot->CACHE;
+    bot->WORK = (FloodWork) {0};
+    bot->WORK.RECORD = true;
+}
+
+void botFree(Bot *bot) {
+    freeMem(bot->STATUS, bot->BOARD);
+    free(bot->CELLS);
+    solverFree(&bot->SOLVER);
+    probabilityFree(&bot->PROBABILITY);
+    probabilityCacheFree(&bot->CACHE);
+    freeFloodWork(&bot->WORK);
+}
+
+void botStatsMerge(BotStats *into, const BotStats *from) {
+    into->GAMES += from->GAMES;
+    into->WINS += from->WINS;
+    into->REVEALS += from->REVEALS;
+    into->CHORDS += from->CHORDS;
+    into->GUESSES += from->GUESSES;
+    into->FLAGS += from->FLAGS;
+    into->CELLS_REVEALED += from->CELLS_REVEALED;
+    for (int b = 0; b < BOT_SIZE_BUCKETS; b++) {
+        into->SIZES[b] += from->SIZES[b];
+    }
+    for (int p = 0; p < BOT_PHASES; p++) {
+        into->SECONDS[p] += from->SECONDS[p];
+    }
+    into->CHECKSUM ^= from->CHECKSUM;
+}
+
+// Buckets an event by the cells it opened; false when it opened none
+static bool countOpened(BotStats *stats, int size) {
+    if (size == 0) {
+        return false;
+    }
+    int bucket = 0;
+    while (bucket < BOT_SIZE_BUCKETS - 1 && (1 << (bucket + 1)) <= size) {
+        bucket++;
+    }
+    stats->SIZES[bucket] += 1;
+    return true;
+}
+
+static void reveal(Bot *bot, Status *status, int cell, BotStats *stats) {
+    int before = bot->WORK.CHANGE_COUNT;
+    revealEmptyCells(bot->BOARD, cell / status->H_TILES, cell % status->H_TILES, status, &bot->WORK);
+    stats->REVEALS += countOpened(stats, bot->WORK.CHANGE_COUNT - before);
+}
+
+// Chords a revealed number next to the hidden cell whose flags account for
+// all its mines and which has another hidden cell to open, so the chord
+// does more than a plain reveal would. Every flag is a proven mine, so the
+// chord opens only safe cells. False when no neighbour qualifies.
+static bool chordNext(Bot *bot, Status *status, int cell, BotStats *stats) {
+    TILE **board = bot->BOARD;
+    int w = status->W_TILES, h = status->H_TILES;
+    int x = cell / h, y = cell % h;
+    for (int nx = x - 1; nx <= x + 1; nx++) {
+        for (int ny = y - 1; ny <= y + 1; ny++) {
+            if (nx < 0 || nx >= w || ny < 0 || ny >= h || !board[nx][ny].VISIBLE || board[nx][ny].TYPE != NUMBER) {
+                continue;
+            }
+            int flagged = 0, hidden = 0;
+            for (int mx = nx - 1; mx <= nx + 1; mx++) {
+                for (int my = ny - 1; my <= ny + 1; my++) {
+                    if (mx < 0 || mx >= w || my < 0 || my >= h || board[mx][my].VISIBLE) {
+                        continue;
+                    }
+                    if (board[mx][my].MARK == CELL_FLAGGED) {
+                        flagged += 1;
+                    } else {
+                        hidden += 1;
+                    }
+                }
+            }
+            if (flagged == board[nx][ny].AMOUNT && hidden > 1) {
+                int before = bot->WORK.CHANGE_COUNT;
+                chordCell(board, nx, ny, status, &bot->WORK);
+                stats->CHORDS += countOpened(stats, bot->WORK.CHANGE_COUNT - before);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+static void flagMines(Bot *bot, Status status, int *flagged, BotStats *stats) {
+    Solver *solver = &bot->SOLVER;
+    for (; *flagged < solver->MINE_COUNT; *flagged += 1) {
+        int cell = solver->MINES[*flagged];
+        TILE *tile = &bot->BOARD[cell / status.H_TILES][cell % status.H_TILES];
+        if (!tile->VISIBLE && tile->MARK == CELL_CLEARED) {
+            markCell(bot->BOARD, cell / status.H_TILES, cell % status.H_TILES, status, &bot->WORK);
+            stats->FLAGS += 1;
+        }
+    }
+}
+
+static int lowestRisk(Bot *bot, Status status) {
+    const float *prob = bot->PROBABILITY.PROB;
+    int best = -1;
+    for (int i = 0; i < status.W_TILES * status.H_TILES; i++) {
+        if (prob[i] >= 0 && bot->SOLVER.KNOWN[i] == KNOWN_NOTHING && (best < 0 || prob[i] < prob[best])) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// Plays game `game` of `seed` to the end and adds it to stats. Returns true on a win.
+bool botPlay(Bot *bot, uint64_t seed, uint64_t game, BotStats *stats) {
+    Status status = bot->STATUS;
+    Solver *solver = &bot->SOLVER;
+    FloodWork *work = &bot->WORK;
+    Rng rng = rngStream(seed, game);
+    int cells = status.W_TILES * status.H_TILES;
+
+    double t0 = botClock();
+    int first = rngRange(&rng, cells);
+    if (!placeMines(bot->BOARD, &status, first / status.H_TILES, first % status.H_TILES, &rng, bot->CELLS)) {
+        return false;
+    }
+    status.STATE = PLAYING;
+    status.VISIBLE_TILES = 0;
+    solverReset(solver);
+    double t1 = botClock();
+    stats->SECONDS[BOT_GENERATE] += t1 - t0;
+
+    work->CHANGE_COUNT = 0;
+    reveal(bot, &status, first, stats);
+    solverUpdate(solver, bot->BOARD, status, work);
+    int flagged = 0, guesses = 0;
+    t0 = botClock();
+    stats->SECONDS[BOT_REVEAL] += t0 - t1;
+
+    while (status.STATE == PLAYING) {
+        solverRun(solver, bot->BOARD, status);
+        flagMines(bot, status, &flagged, stats);
+        t1 = botClock();
+        stats->SECONDS[BOT_SOLVE] += t1 - t0;
+
+        work->CHANGE_COUNT = 0;
+        if (solver->SAFE_COUNT > 0) {
+            for (int i = 0; i < solver->SAFE_COUNT && status.STATE == PLAYING; i++) {
+                int cell = solver->SAFE[i];
+                if (!bot->BOARD[cell / status.H_TILES][cell % status.H_TILES].VISIBLE
+                    && !chordNext(bot, &status, cell, stats)) {
+                    reveal(bot, &status, cell, stats);
+                }
+            }
+            solver->SAFE_COUNT = 0;
+            t0 = t1;
+        } else {
+            computeProbabilities(&bot->PROBABILITY, bot->BOARD, status, solver);
+            int cell = lowestRisk(bot, status);
+            t0 = botClock();
+            stats->SECONDS[BOT_GUESS] += t0 - t1;
+            if (cell < 0) {
+                break;
+            }
+            reveal(bot, &status, cell, stats);
+            guesses++;
+        }
+        solverUpdate(solver, bot->BOARD, status, work);
+        t1 = botClock();
+        stats->SECONDS[BOT_REVEAL] += t1 - t0;
+        t0 = t1;
+    }
+
+    bool won = status.STATE == WIN;
+    stats->GAMES += 1;
+    stats->WINS += won;
+    stats->GUESSES += guesses;
+    stats->CELLS_REVEALED += status.VISIBLE_TILES;
+    Rng fold = rngStream(game, (uint64_t) won << 32 | (uint32_t) status.VISIBLE_TILES << 8 | (guesses & 0xFF));
+    stats->CHECKSUM ^= rngNext(&fold);
+    return won;
+}
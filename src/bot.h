@@ -0,0 +1,56 @@
+#ifndef BOT_H
+#define BOT_H
+
+#include <stdint.h>
+#include "game.h"
+#include "solver.h"
+#include "probability.h"
+
+typedef enum BotPhase {
+    BOT_GENERATE,
+    BOT_REVEAL,
+    BOT_SOLVE,
+    BOT_GUESS,
+    BOT_PHASES
+} BotPhase;
+
+#define BOT_SIZE_BUCKETS 21     // reveal sizes by power of two, last one open ended
+
+// Totals over any number of games. Merging is plain addition and the
+// checksum is an order independent fold of every game's outcome, so split
+// runs of the same seed report the same numbers.
+typedef struct BotStats {
+    long GAMES;
+    long WINS;
+    long REVEALS;
+    long CHORDS;
+    long GUESSES;
+    long FLAGS;
+    long CELLS_REVEALED;
+    long SIZES[BOT_SIZE_BUCKETS];  // cells opened per reveal or chord
+    double SECONDS[BOT_PHASES];
+    uint64_t CHECKSUM;
+} BotStats;
+
+// Scratch for one player: flag what the solver proves mined, open what it
+// proves safe, otherwise guess the lowest mine probability. A safe cell
+// next to a number whose mines are all flagged is opened by chording that
+// number, so one event clears every hidden cell around it. REVEALS, CHORDS
+// and FLAGS count events, as a player's clicks would. Game k of a
+// seed is drawn from rngStream(seed, k), first click included.
+typedef struct Bot {
+    Status STATUS;
+    TILE **BOARD;
+    int *CELLS;
+    Solver SOLVER;
+    Probability PROBABILITY;
+    ProbabilityCache CACHE;
+    FloodWork WORK;
+} Bot;
+
+void botInit(Bot *bot, Status status);
+void botFree(Bot *bot);
+void botStatsMerge(BotStats *into, const BotStats *from);
+bool botPlay(Bot *bot, uint64_t seed, uint64_t game, BotStats *stats);
+
+#endif
@@ -0,0 +1,513 @@
+#include "corpus.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define GRID_MINE 1
+#define GRID_BLOCKED 2      // kept free of mines by the first click policy
+#define GRID_ZERO 4         // no mine around
+#define GRID_COVERED 8      // uncovered by an opening already counted
+#define GRID_BORDER 16
+
+size_t corpusRecordSize(int width, int height) {
+    return sizeof(CorpusRecord) + (((size_t) width * height + 63) / 64) * sizeof(uint64_t);
+}
+
+void corpusGeneratorInit(CorpusGenerator *generator, Status status, FirstClick policy, uint32_t flags) {
+    int w = status.W_TILES, h = status.H_TILES;
+    *generator = (CorpusGenerator) {.STATUS = status, .POLICY = policy, .FLAGS = flags};
+    generator->CELLS = malloc(w * h * sizeof(int));
+    if (h <= CORPUS_COLUMN_BITS) {
+        generator->MINE = malloc((w + 2) * sizeof(uint64_t));
+        generator->BLOCKED = malloc((w + 2) * sizeof(uint64_t));
+        generator->ZERO = malloc((w + 2) * sizeof(uint64_t));
+        generator->PARENT = malloc(w * (CORPUS_COLUMN_BITS / 2) * sizeof(int));
+    } else {
+        generator->GRID = malloc((w + 2) * (h + 2));
+        generator->SUM = malloc((w + 2) * (h + 2));
+        generator->STACK = malloc(w * h * sizeof(int));
+    }
+    if (policy == CLICK_NO_GUESS || (flags & CORPUS_ALL_METRICS)) {
+        generator->BOARD = allocBoard(w, h);
+    }
+    if (policy == CLICK_NO_GUESS) {
+        noGuessInit(&generator->NOGUESS, status);
+    }
+}
+
+void corpusGeneratorFree(CorpusGenerator *generator) {
+    if (generator->POLICY == CLICK_NO_GUESS) {
+        noGuessFree(&generator->NOGUESS);
+    }
+    if (generator->BOARD != NULL) {
+        freeMem(generator->STATUS, generator->BOARD);
+    }
+    freeMetricsWork(&generator->METRICS);
+    free(generator->MINE);
+    free(generator->BLOCKED);
+    free(generator->ZERO);
+    free(generator->PARENT);
+    free(generator->GRID);
+    free(generator->SUM);
+    free(generator->STACK);
+    free(generator->CELLS);
+}
+
+// Record metrics saturate rather than wrap on huge boards
+static uint16_t saturate(int value) {
+    return value > UINT16_MAX ? UINT16_MAX : value;
+}
+
+static int clickRadius(FirstClick policy) {
+    return policy == CLICK_OPENING ? 1 : policy == CLICK_SAFE ? 0 : -1;
+}
+
+static int findRun(int *parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+// Empty columns with the cells the policy keeps clear of mines blocked.
+// Returns how many cells may take a mine.
+static int clearColumns(CorpusGenerator *generator, int x, int y) {
+    int w = generator->STATUS.W_TILES, h = generator->STATUS.H_TILES, radius = clickRadius(generator->POLICY);
+    memset(generator->MINE, 0, (w + 2) * sizeof(uint64_t));
+    memset(generator->BLOCKED, 0, (w + 2) * sizeof(uint64_t));
+    int blocked = 0;
+    for (int cx = x - radius; cx <= x + radius; cx++) {
+        for (int cy = y - radius; cy <= y + radius; cy++) {
+            if (cx >= 0 && cx < w && cy >= 0 && cy < h) {
+                generator->BLOCKED[cx + 1] |= (uint64_t) 2 << cy;
+                blocked += 1;
+            }
+        }
+    }
+    return w * h - blocked;
+}
+
+// Same draws as dealMines, so both layouts deal the same board
+static bool dealColumns(CorpusGenerator *generator, int free, Rng *rng) {
+    int w = generator->STATUS.W_TILES, h = generator->STATUS.H_TILES, bombs = generator->STATUS.BOMBS;
+    uint64_t *mine = generator->MINE, *blocked = generator->BLOCKED;
+    if (bombs > free) {
+        return false;
+    }
+
+    if (bombs * 2 <= free) {
+        for (int placed = 0; placed < bombs;) {
+            int cell = rngRange(rng, w * h);
+            uint64_t bit = (uint64_t) 2 << (cell % h);
+            if (!((mine[cell / h + 1] | blocked[cell / h + 1]) & bit)) {
+                mine[cell / h + 1] |= bit;
+                placed += 1;
+            }
+        }
+        return true;
+    }
+
+    int count = 0;
+    for (int cell = 0; cell < w * h; cell++) {
+        if (!((blocked[cell / h + 1] >> (cell % h + 1)) & 1)) {
+            generator->CELLS[count++] = cell;
+        }
+    }
+    for (int i = 0; i < bombs; i++) {
+        int pick = i + rngRange(rng, count - i);
+        int cell = generator->CELLS[pick];
+        generator->CELLS[pick] = generator->CELLS[i];
+        generator->CELLS[i] = cell;
+        mine[cell / h + 1] |= (uint64_t) 2 << (cell % h);
+    }
+    return true;
+}
+
+// Zero cells are those outside the 3x3 spread of every mine. Openings are
+// counted as vertical runs of zeros minus the merges between runs that
+// touch across neighbouring columns, diagonals included; 3BV adds the
+// numbers outside the spread of every zero.
+static void measureColumns(CorpusGenerator *generator, CorpusRecord *record) {
+    int w = generator->STATUS.W_TILES, h = generator->STATUS.H_TILES;
+    uint64_t valid = (((uint64_t) 1 << h) - 1) << 1;
+    uint64_t *mine = generator->MINE, *zero = generator->ZERO;
+    int *parent = generator->PARENT;
+
+    zero[0] = zero[w + 1] = 0;
+    for (int x = 1; x <= w; x++) {
+        uint64_t near = mine[x - 1] | mine[x] | mine[x + 1];
+        zero[x] = ~(near | near << 1 | near >> 1) & valid;
+    }
+
+    uint64_t previous[CORPUS_COLUMN_BITS / 2], current[CORPUS_COLUMN_BITS / 2];
+    int previousId[CORPUS_COLUMN_BITS / 2], currentId[CORPUS_COLUMN_BITS / 2];
+    int previousCount = 0, runs = 0, merges = 0, isolated = 0;
+    for (int x = 1; x <= w; x++) {
+        int count = 0;
+        for (uint64_t rest = zero[x]; rest;) {
+            uint64_t low = rest & -rest;
+            uint64_t run = rest & ~(rest + low);
+            rest &= ~run;
+            int id = runs++;
+            parent[id] = id;
+            uint64_t reach = run | run << 1 | run >> 1;
+            for (int k = 0; k < previousCount; k++) {
+                if (previous[k] & reach) {
+                    int a = findRun(parent, id), b = findRun(parent, previousId[k]);
+                    if (a != b) {
+                        parent[a] = b;
+                        merges += 1;
+                    }
+                }
+            }
+            current[count] = run;
+            currentId[count++] = id;
+        }
+        memcpy(previous, current, count * sizeof(uint64_t));
+        memcpy(previousId, currentId, count * sizeof(int));
+        previousCount = count;
+
+        uint64_t spread = zero[x - 1] | zero[x] | zero[x + 1];
+        spread |= spread << 1 | spread >> 1;
+        isolated += __builtin_popcountll(valid & ~mine[x] & ~spread);
+    }
+    record->OPENINGS = saturate(runs - merges);
+    record->ISOLATED = saturate(isolated);
+    record->BBBV = saturate(runs - merges + isolated);
+
+    memset(record->MINES, 0, (w * h + 63) / 64 * sizeof(uint64_t));
+    for (int x = 0; x < w; x++) {
+        uint64_t bits = mine[x + 1] >> 1;
+        int i = x * h, offset = i & 63;
+        record->MINES[i >> 6] |= bits << offset;
+        if (offset + h > 64) {
+            record->MINES[(i >> 6) + 1] |= bits >> (64 - offset);
+        }
+    }
+}
+
+// Border marked, every cell empty, then the cells the policy keeps clear
+// of mines blocked as well. Returns how many cells may take a mine.
+static int clearGrid(CorpusGenerator *generator, int x, int y) {
+    int w = generator->STATUS.W_TILES, h = generator->STATUS.H_TILES, stride = h + 2;
+    unsigned char *grid = generator->GRID;
+    memset(grid, GRID_BORDER, stride);
+    memset(grid + (w + 1) * stride, GRID_BORDER, stride);
+    for (int cx = 1; cx <= w; cx++) {
+        grid[cx * stride] = GRID_BORDER;
+        memset(grid + cx * stride + 1, 0, h);
+        grid[cx * stride + h + 1] = GRID_BORDER;
+    }
+
+    int radius = clickRadius(generator->POLICY), blocked = 0;
+    for (int cx = x - radius; cx <= x + radius; cx++) {
+        for (int cy = y - radius; cy <= y + radius; cy++) {
+            if (cx >= 0 && cx < w && cy >= 0 && cy < h) {
+                grid[(cx + 1) * stride + cy + 1] = GRID_BLOCKED;
+                blocked += 1;
+            }
+        }
+    }
+    return w * h - blocked;
+}
+
+// BOMBS mines on unblocked cells. Sparse boards draw cells until they hit a
+// free one; dense boards shuffle the free cells, so neither case stalls.
+static bool dealMines(CorpusGenerator *generator, int free, Rng *rng) {
+    int w = generator->STATUS.W_TILES, h = generator->STATUS.H_TILES, stride = h + 2;
+    int bombs = generator->STATUS.BOMBS;
+    unsigned char *grid = generator->GRID;
+    if (bombs > free) {
+        return false;
+    }
+
+    if (bombs * 2 <= free) {
+        for (int placed = 0; placed < bombs;) {
+            int cell = rngRange(rng, w * h);
+            unsigned char *slot = &grid[(cell / h + 1) * stride + cell % h + 1];
+            if (*slot == 0) {
+                *slot = GRID_MINE;
+                placed += 1;
+            }
+        }
+        return true;
+    }
+
+    int count = 0;
+    for (int cell = 0; cell < w * h; cell++) {
+        if (grid[(cell / h + 1) * stride + cell % h + 1] == 0) {
+            generator->CELLS[count++] = cell;
+        }
+    }
+    for (int i = 0; i < bombs; i++) {
+        int pick = i + rngRange(rng, count - i);
+        int cell = generator->CELLS[pick];
+        generator->CELLS[pick] = generator->CELLS[i];
+        generator->CELLS[i] = cell;
+        grid[(cell / h + 1) * stride + cell % h + 1] = GRID_MINE;
+    }
+    return true;
+}
+
+// Mine counts as two separable passes: vertical triples into SUM, then each
+// cell adds the triples of its own and both neighbouring columns. Zero cells
+// are flagged in GRID; nothing else about the numbers is kept.
+static void markZeros(CorpusGenerator *generator) {
+    int w = generator->STATUS.W_TILES, h = generator->STATUS.H_TILES, stride = h + 2;
+    unsigned char *grid = generator->GRID, *sum = generator->SUM;
+    for (int cx = 0; cx < w + 2; cx++) {
+        unsigned char *column = grid + cx * stride, *out = sum + cx * stride;
+        for (int cy = 1; cy <= h; cy++) {
+            out[cy] = (column[cy - 1] & GRID_MINE) + (column[cy] & GRID_MINE) + (column[cy + 1] & GRID_MINE);
+        }
+    }
+    for (int cx = 1; cx <= w; cx++) {
+        for (int cy = 1; cy <= h; cy++) {
+            int p = cx * stride + cy;
+            if (!(grid[p] & GRID_MINE) && sum[p - stride] + sum[p] + sum[p + stride] == 0) {
+                grid[p] |= GRID_ZERO;
+            }
+        }
+    }
+}
+
+// Openings are the 8-connected zero regions; 3BV adds every number that no
+// opening uncovers. One flood per opening, each cell pushed at most once.
+static void countOpenings(CorpusGenerator *generator, CorpusRecord *record) {
+    static const int order[8][2] = {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}};
+    int w = generator->STATUS.W_TILES, h = generator->STATUS.H_TILES, stride = h + 2;
+    unsigned char *grid = generator->GRID;
+    int *stack = generator->STACK;
+    int offsets[8];
+    for (int d = 0; d < 8; d++) {
+        offsets[d] = order[d][0] * stride + order[d][1];
+    }
+
+    int openings = 0, numbers = 0, covered = 0;
+    for (int cx = 1; cx <= w; cx++) {
+        for (int cy = 1; cy <= h; cy++) {
+            int p = cx * stride + cy;
+            if (grid[p] & GRID_MINE) {
+                continue;
+            }
+            if (!(grid[p] & GRID_ZERO)) {
+                numbers += 1;
+                continue;
+            }
+            if (grid[p] & GRID_COVERED) {
+                continue;
+            }
+            openings += 1;
+            int top = 0;
+            grid[p] |= GRID_COVERED;
+            stack[top++] = p;
+            while (top > 0) {
+                int q = stack[--top];
+                for (int d = 0; d < 8; d++) {
+                    int n = q + offsets[d];
+                    unsigned char cell = grid[n];
+                    if (cell & (GRID_COVERED | GRID_MINE | GRID_BORDER)) {
+                        continue;
+                    }
+                    grid[n] = cell | GRID_COVERED;
+                    if (cell & GRID_ZERO) {
+                        stack[top++] = n;
+                    } else {
+                        covered += 1;
+                    }
+                }
+            }
+        }
+    }
+    record->OPENINGS = saturate(openings);
+    record->ISOLATED = saturate(numbers - covered);
+    record->BBBV = saturate(openings + numbers - covered);
+}
+
+// Mine bits of column x shifted up one, so row y is bit y + 1 and rows -1
+// and H_TILES read as empty. Only for columns of at most 62 cells.
+static uint64_t recordColumn(const CorpusRecord *record, int x, int h) {
+    int i = x * h, offset = i & 63;
+    uint64_t bits = record->MINES[i >> 6] >> offset;
+    if (offset + h > 64) {
+        bits |= record->MINES[(i >> 6) + 1] << (64 - offset);
+    }
+    return (bits & (((uint64_t) 1 << h) - 1)) << 1;
+}
+
+// Mines and numbers of a record into a w x h board, nothing visible or
+// marked. Returns the mine count.
+static int decodeRecord(const CorpusRecord *record, int w, int h, TILE **board) {
+    int bombs = 0;
+    if (h <= CORPUS_COLUMN_BITS) {
+        uint64_t previous = 0, current = recordColumn(record, 0, h);
+        for (int x = 0; x < w; x++) {
+            uint64_t next = x + 1 < w ? recordColumn(record, x + 1, h) : 0;
+            TILE *column = board[x];
+            for (int y = 0; y < h; y++) {
+                bool mine = (current >> (y + 1)) & 1;
+                int amount = __builtin_popcountll((previous >> y) & 7) + __builtin_popcountll((next >> y) & 7)
+                             + __builtin_popcountll((current >> y) & 5);
+                column[y].TYPE = mine ? MINE : amount ? NUMBER : BLANK_TILE;
+                column[y].AMOUNT = mine ? 0 : amount;
+                column[y].MARK = CELL_CLEARED;
+                column[y].VISIBLE = false;
+                bombs += mine;
+            }
+            previous = current;
+            current = next;
+        }
+    } else {
+        // Cells first, then every mine counts itself into its neighbours
+        for (int x = 0; x < w; x++) {
+            TILE *column = board[x];
+            for (int y = 0; y < h; y++) {
+                int i = x * h + y;
+                column[y].TYPE = (record->MINES[i >> 6] >> (i & 63)) & 1 ? MINE : BLANK_TILE;
+                column[y].AMOUNT = 0;
+                column[y].MARK = CELL_CLEARED;
+                column[y].VISIBLE = false;
+            }
+        }
+        for (int k = 0; k < (w * h + 63) / 64; k++) {
+            for (uint64_t bits = record->MINES[k]; bits; bits &= bits - 1) {
+                int i = k * 64 + __builtin_ctzll(bits);
+                int x = i / h, y = i % h;
+                bombs += 1;
+                for (int nx = x - 1; nx <= x + 1; nx++) {
+                    for (int ny = y - 1; ny <= y + 1; ny++) {
+                        if (nx >= 0 && nx < w && ny >= 0 && ny < h && board[nx][ny].TYPE != MINE) {
+                            board[nx][ny].TYPE = NUMBER;
+                            board[nx][ny].AMOUNT += 1;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return bombs;
+}
+
+// Board from the rng's stream: the click first, then the mines under the
+// generator's policy. Fills every field of the record.
+bool corpusGenerate(CorpusGenerator *generator, Rng rng, CorpusRecord *record) {
+    Status status = generator->STATUS;
+    int w = status.W_TILES, h = status.H_TILES, stride = h + 2;
+    bool columns = h <= CORPUS_COLUMN_BITS;
+    record->SEED = rng.STATE;
+    record->CLICK_X = rngRange(&rng, w);
+    record->CLICK_Y = rngRange(&rng, h);
+    int free = columns ? clearColumns(generator, record->CLICK_X, record->CLICK_Y)
+                       : clearGrid(generator, record->CLICK_X, record->CLICK_Y);
+
+    if (generator->POLICY != CLICK_NO_GUESS) {
+        if (!(columns ? dealColumns(generator, free, &rng) : dealMines(generator, free, &rng))) {
+            return false;
+        }
+    } else {
+        if (!generateNoGuess(generator->BOARD, &status, record->CLICK_X, record->CLICK_Y, &rng, &generator->NOGUESS)) {
+            return false;
+        }
+        for (int x = 0; x < w; x++) {
+            for (int y = 0; y < h; y++) {
+                if (generator->BOARD[x][y].TYPE != MINE) {
+                    continue;
+                }
+                if (columns) {
+                    generator->MINE[x + 1] |= (uint64_t) 2 << y;
+                } else {
+                    generator->GRID[(x + 1) * stride + y + 1] = GRID_MINE;
+                }
+            }
+        }
+    }
+
+    if (columns) {
+        measureColumns(generator, record);
+    } else {
+        markZeros(generator);
+        countOpenings(generator, record);
+        memset(record->MINES, 0, (w * h + 63) / 64 * sizeof(uint64_t));
+        for (int x = 0; x < w; x++) {
+            const unsigned char *column = generator->GRID + (x + 1) * stride + 1;
+            for (int y = 0; y < h; y++) {
+                int i = x * h + y;
+                record->MINES[i >> 6] |= (uint64_t) (column[y] & GRID_MINE) << (i & 63);
+            }
+        }
+    }
+
+    record->ISLANDS = 0;
+    record->ZINI = 0;
+    record->RESERVED = 0;
+    if (generator->FLAGS & CORPUS_ALL_METRICS) {
+        BoardMetrics metrics;
+        decodeRecord(record, w, h, generator->BOARD);
+        computeMetrics(generator->BOARD, status, &generator->METRICS, &metrics);
+        record->ISLANDS = saturate(metrics.ISLANDS);
+        record->ZINI = saturate(metrics.ZINI);
+    }
+    return true;
+}
+
+// Map a corpus read only. The header is checked against the file size, so
+// every index below HEADER.COUNT is a whole record. sequential asks the
+// kernel to read ahead aggressively and drop pages behind a scan.
+bool corpusOpen(Corpus *corpus, const char *path, bool sequential) {
+    *corpus = (Corpus) {0};
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(CorpusHeader)) {
+        close(fd);
+        return false;
+    }
+    void *base = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) {
+        return false;
+    }
+
+    CorpusHeader header;
+    memcpy(&header, base, sizeof(header));
+    if (header.MAGIC != CORPUS_MAGIC || header.VERSION != CORPUS_VERSION || header.W_TILES < 1 || header.H_TILES < 1
+        || header.RECORD_SIZE != corpusRecordSize(header.W_TILES, header.H_TILES)
+        || header.COUNT > (st.st_size - sizeof(header)) / header.RECORD_SIZE) {
+        munmap(base, st.st_size);
+        return false;
+    }
+    madvise(base, st.st_size, sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+
+    corpus->BASE = base;
+    corpus->SIZE = st.st_size;
+    corpus->HEADER = header;
+    corpus->RECORDS = corpus->BASE + sizeof(header);
+    return true;
+}
+
+void corpusClose(Corpus *corpus) {
+    if (corpus->BASE != NULL) {
+        munmap((void *) corpus->BASE, corpus->SIZE);
+    }
+    *corpus = (Corpus) {0};
+}
+
+
+// Write one record straight into a board of the corpus's size, ready to
+// play from the stored click
+bool corpusDecode(const Corpus *corpus, const CorpusRecord *record, TILE **board, Status *status) {
+    if (status->W_TILES != corpus->HEADER.W_TILES || status->H_TILES != corpus->HEADER.H_TILES) {
+        return false;
+    }
+    status->BOMBS = decodeRecord(record, status->W_TILES, status->H_TILES, board);
+    status->VISIBLE_TILES = 0;
+    status->STATE = START;
+    return true;
+}
@@ -0,0 +1,104 @@
+#ifndef CORPUS_H
+#define CORPUS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "game.h"
+#include "metrics.h"
+#include "noguess.h"
+
+#define CORPUS_MAGIC 0x50434D4D     // "MMCP" in little endian
+#define CORPUS_VERSION 2
+#define CORPUS_ALL_METRICS 1        // header flag: records carry ISLANDS and ZINI
+
+// Where the first click may land relative to the mines
+typedef enum FirstClick {
+    CLICK_ANY,          // mines anywhere, the click may lose
+    CLICK_SAFE,         // never on a mine
+    CLICK_OPENING,      // no mine in its 3x3, so it always opens
+    CLICK_NO_GUESS,     // an opening the solver finishes without guessing
+    CLICK_POLICIES
+} FirstClick;
+
+// Corpus layout: this header, then COUNT records of RECORD_SIZE bytes each,
+// so board i starts at sizeof(CorpusHeader) + i * RECORD_SIZE. Fields are in
+// host byte order. COUNT is patched in once the last record is written.
+typedef struct CorpusHeader {
+    uint32_t MAGIC;
+    uint32_t VERSION;
+    int32_t W_TILES;
+    int32_t H_TILES;
+    int32_t BOMBS;
+    int32_t POLICY;
+    uint64_t SEED;
+    uint64_t COUNT;
+    uint32_t RECORD_SIZE;
+    uint32_t FLAGS;
+} CorpusHeader;
+
+// One board. SEED is the starting state of the board's rng stream, so
+// generating from Rng {SEED} with the header's size and policy reproduces
+// it. Metrics are those of computeMetrics, saturated at 65535; ISLANDS and
+// ZINI are 0 unless the header has CORPUS_ALL_METRICS. Mine bit i of MINES is cell
+// i = x * H_TILES + y, padded to whole words.
+typedef struct CorpusRecord {
+    uint64_t SEED;
+    uint16_t CLICK_X;
+    uint16_t CLICK_Y;
+    uint16_t BBBV;
+    uint16_t OPENINGS;
+    uint16_t ISOLATED;
+    uint16_t ISLANDS;
+    uint16_t ZINI;
+    uint16_t RESERVED;
+    uint64_t MINES[];
+} CorpusRecord;
+
+#define CORPUS_COLUMN_BITS 62    // tallest board kept one word per column
+
+// Per-thread scratch, allocated once and reused for every board. Boards up
+// to CORPUS_COLUMN_BITS tall are dealt into one word per column, bit y + 1
+// for row y, and numbered and measured with word operations. Taller boards
+// use a byte grid with a one cell border. Either way the columns are laid
+// out like the TILE board and need no bounds checks. The no-guess policy
+// goes through a TILE board and the solver, and CORPUS_ALL_METRICS decodes
+// every board into one for computeMetrics.
+typedef struct CorpusGenerator {
+    Status STATUS;
+    FirstClick POLICY;
+    uint32_t FLAGS;
+    uint64_t *MINE;         // W_TILES + 2 column words, border columns empty
+    uint64_t *BLOCKED;
+    uint64_t *ZERO;
+    int *PARENT;            // union-find over the zero runs of every column
+    unsigned char *GRID;    // (W_TILES + 2) * (H_TILES + 2) cell flags
+    unsigned char *SUM;     // same layout: mines in each vertical triple
+    int *STACK;
+    int *CELLS;
+    TILE **BOARD;
+    NoGuess NOGUESS;
+    MetricsWork METRICS;
+} CorpusGenerator;
+
+// Read-only view of a corpus file mapped into memory. Records are fixed
+// stride, so board i is found in O(1) and read in place without copying.
+typedef struct Corpus {
+    const unsigned char *BASE;
+    size_t SIZE;
+    CorpusHeader HEADER;
+    const unsigned char *RECORDS;
+} Corpus;
+
+size_t corpusRecordSize(int width, int height);
+void corpusGeneratorInit(CorpusGenerator *generator, Status status, FirstClick policy, uint32_t flags);
+void corpusGeneratorFree(CorpusGenerator *generator);
+bool corpusGenerate(CorpusGenerator *generator, Rng rng, CorpusRecord *record);
+bool corpusOpen(Corpus *corpus, const char *path, bool sequential);
+void corpusClose(Corpus *corpus);
+bool corpusDecode(const Corpus *corpus, const CorpusRecord *record, TILE **board, Status *status);
+
+static inline const CorpusRecord *corpusRecord(const Corpus *corpus, uint64_t index) {
+    return (const CorpusRecord *) (corpus->RECORDS + index * corpus->HEADER.RECORD_SIZE);
+}
+
+#endif
@@ -0,0 +1,296 @@
+#include "density.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+void densityInit(DensityMap *map, Status status) {
+    map->W_TILES = status.W_TILES;
+    map->H_TILES = status.H_TILES;
+    map->WEIGHT = malloc(status.W_TILES * status.H_TILES * sizeof(float));
+    densityFill(map, 1);
+}
+
+void densityFree(DensityMap *map) {
+    free(map->WEIGHT);
+}
+
+void densityFill(DensityMap *map, float weight) {
+    int cells = map->W_TILES * map->H_TILES;
+    for (int i = 0; i < cells; i++) {
+        map->WEIGHT[i] = weight;
+    }
+}
+
+// Linear ramp from `from` at (x0, y0) to `to` at (x1, y1), constant past
+// either end
+void densityGradient(DensityMap *map, float x0, float y0, float from, float x1, float y1, float to) {
+    float dx = x1 - x0, dy = y1 - y0;
+    float length = dx * dx + dy * dy;
+    for (int x = 0; x < map->W_TILES; x++) {
+        for (int y = 0; y < map->H_TILES; y++) {
+            float t = length > 0 ? ((x - x0) * dx + (y - y0) * dy) / length : 0;
+            t = t < 0 ? 0 : t > 1 ? 1 : t;
+            map->WEIGHT[x * map->H_TILES + y] *= from + (to - from) * t;
+        }
+    }
+}
+
+static float smooth(float t) {
+    return t * t * (3 - 2 * t);
+}
+
+// Value noise on a lattice every `scale` cells, smoothly interpolated, so
+// mines gather in blobs about scale cells across. A lattice value v in
+// [0, 1) becomes the factor exp(contrast * (2v - 1)): contrast 0 changes
+// nothing and 2 spreads the weights over a ratio of about 50. A scale
+// below 1 is taken as 1.
+void densityNoise(DensityMap *map, Rng *rng, int scale, float contrast) {
+    scale = scale > 1 ? scale : 1;
+    int lw = map->W_TILES / scale + 2, lh = map->H_TILES / scale + 2;
+    float *lattice = malloc(lw * lh * sizeof(float));
+    for (int i = 0; i < lw * lh; i++) {
+        lattice[i] = (rngNext(rng) >> 40) * (1.0f / (1 << 24));
+    }
+
+    for (int x = 0; x < map->W_TILES; x++) {
+        int lx = x / scale;
+        float fx = smooth((float) (x % scale) / scale);
+        const float *left = &lattice[lx * lh], *right = &lattice[(lx + 1) * lh];
+        for (int y = 0; y < map->H_TILES; y++) {
+            int ly = y / scale;
+            float fy = smooth((float) (y % scale) / scale);
+            float a = left[ly] + (left[ly + 1] - left[ly]) * fy;
+            float b = right[ly] + (right[ly + 1] - right[ly]) * fy;
+            map->WEIGHT[x * map->H_TILES + y] *= expf(contrast * (2 * (a + (b - a) * fx) - 1));
+        }
+    }
+    free(lattice);
+}
+
+// Multiply the cells whose mask byte is set by weight; 0 keeps mines out
+void densityMask(DensityMap *map, const unsigned char *mask, float weight) {
+    int cells = map->W_TILES * map->H_TILES;
+    for (int i = 0; i < cells; i++) {
+        if (mask[i]) {
+            map->WEIGHT[i] *= weight;
+        }
+    }
+}
+
+void densitySamplerInit(DensitySampler *sampler, Status status) {
+    int cells = status.W_TILES * status.H_TILES;
+    sampler->BASE = malloc(cells * sizeof(AliasSlot));
+    sampler->BASE_COUNT = 0;
+    sampler->INVERSE = malloc(cells * sizeof(float));
+    sampler->KEYS = malloc(cells * sizeof(DensityKey));
+    sampler->SCALED = malloc(cells * sizeof(double));
+    sampler->WORK = malloc(cells * sizeof(int));
+    sampler->MINED = malloc((cells + 63) / 64 * sizeof(uint64_t));
+    sampler->DRAWS = 0;
+    sampler->KEYED = 0;
+}
+
+void densitySamplerFree(DensitySampler *sampler) {
+    free(sampler->BASE);
+    free(sampler->INVERSE);
+    free(sampler->KEYS);
+    free(sampler->SCALED);
+    free(sampler->WORK);
+    free(sampler->MINED);
+}
+
+#define ALIAS_WINDOW 64
+
+// Vose's construction over the cells in slots[0, n). WORK holds the
+// under-full slots as a stack from the front and the over-full ones from
+// the back; each step tops up one under-full slot from an over-full one.
+static void buildTable(DensitySampler *sampler, AliasSlot *slots, int n, const float *weight) {
+    double total = 0;
+    for (int i = 0; i < n; i++) {
+        total += weight[slots[i].CELL];
+    }
+
+    double factor = n / total;
+    int small = 0, large = n;
+    for (int i = 0; i < n; i++) {
+        sampler->SCALED[i] = weight[slots[i].CELL] * factor;
+        if (sampler->SCALED[i] < 1) {
+            sampler->WORK[small++] = i;
+        } else {
+            sampler->WORK[--large] = i;
+        }
+    }
+    while (small > 0 && large < n) {
+        int s = sampler->WORK[--small];
+        int l = sampler->WORK[large];
+        double scaled = sampler->SCALED[s];
+        slots[s].THRESHOLD = scaled > 0 ? (uint32_t) (scaled * 4294967296.0) : 0;
+        slots[s].ALIAS = slots[l].CELL;
+        sampler->SCALED[l] -= 1 - scaled;
+        if (sampler->SCALED[l] < 1) {
+            large += 1;
+            sampler->WORK[small++] = l;
+        }
+    }
+    // Whatever is left is full up to rounding
+    while (small > 0) {
+        int s = sampler->WORK[--small];
+        slots[s].THRESHOLD = UINT32_MAX;
+        slots[s].ALIAS = slots[s].CELL;
+    }
+    for (int i = large; i < n; i++) {
+        int l = sampler->WORK[i];
+        slots[l].THRESHOLD = UINT32_MAX;
+        slots[l].ALIAS = slots[l].CELL;
+    }
+}
+
+// Puts the n smallest keys first, in no order (Hoare's selection)
+static void selectSmallest(DensityKey *keys, int count, int n) {
+    int lo = 0, hi = count - 1;
+    while (lo < hi) {
+        float pivot = keys[lo + (hi - lo) / 2].KEY;
+        int i = lo, j = hi;
+        while (i <= j) {
+            while (keys[i].KEY < pivot) {
+                i++;
+            }
+            while (keys[j].KEY > pivot) {
+                j--;
+            }
+            if (i <= j) {
+                DensityKey swap = keys[i];
+                keys[i++] = keys[j];
+                keys[j--] = swap;
+            }
+        }
+        if (n - 1 <= j) {
+            hi = j;
+        } else if (n - 1 >= i) {
+            lo = i;
+        } else {
+            return;
+        }
+    }
+}
+
+static inline uint32_t keyBits(float key) {
+    uint32_t bits;
+    memcpy(&bits, &key, sizeof(bits));
+    return bits;
+}
+
+#define KEY_BUCKET_SHIFT 20
+
+// Mines the n free cells of smallest key. Positive floats order like their
+// bits, so a histogram of the top bits finds the bucket holding the n-th
+// key; everything below it is mined outright and only that bucket is
+// sorted out by selection.
+static void placeByKey(TILE **board, int h, Rng *rng, DensitySampler *sampler, int n) {
+    const uint64_t *mined = sampler->MINED;
+    DensityKey *keys = sampler->KEYS;
+    int count = sampler->BASE_COUNT;
+    int histogram[1 << (32 - KEY_BUCKET_SHIFT)] = {0};
+    for (int i = 0; i < count; i++) {
+        int cell = sampler->BASE[i].CELL;
+        float key = INFINITY;
+        if (!(mined[cell >> 6] >> (cell & 63) & 1)) {
+            // u in (0, 1], so the key is finite
+            float u = ((rngNext(rng) >> 40) + 1) * (1.0f / (1 << 24));
+            key = -logf(u) * sampler->INVERSE[i];
+        }
+        keys[i].KEY = key;
+        keys[i].CELL = cell;
+        histogram[keyBits(key) >> KEY_BUCKET_SHIFT] += 1;
+    }
+
+    uint32_t bucket = 0;
+    int below = 0;
+    while (below + histogram[bucket] < n) {
+        below += histogram[bucket++];
+    }
+    int tied = 0;
+    for (int i = 0; i < count; i++) {
+        uint32_t b = keyBits(keys[i].KEY) >> KEY_BUCKET_SHIFT;
+        if (b < bucket) {
+            board[keys[i].CELL / h][keys[i].CELL % h].TYPE = MINE;
+        } else if (b == bucket) {
+            keys[tied++] = keys[i];
+        }
+    }
+    selectSmallest(keys, tied, n - below);
+    for (int i = 0; i < n - below; i++) {
+        board[keys[i].CELL / h][keys[i].CELL % h].TYPE = MINE;
+    }
+}
+
+// Table of every cell with a positive weight outside the first click's 3x3.
+// The map must not change until the next densityPrepare.
+void densityPrepare(DensitySampler *sampler, const DensityMap *map, int x, int y) {
+    int h = map->H_TILES;
+    int count = 0;
+    for (int i = 0; i < map->W_TILES; i++) {
+        for (int j = 0; j < h; j++) {
+            float weight = map->WEIGHT[i * h + j];
+            if ((abs(i - x) > 1 || abs(j - y) > 1) && weight > 0) {
+                sampler->INVERSE[count] = 1 / weight;
+                sampler->BASE[count++].CELL = i * h + j;
+            }
+        }
+    }
+    sampler->BASE_COUNT = count;
+    if (count > 0) {
+        buildTable(sampler, sampler->BASE, count, map->WEIGHT);
+    }
+}
+
+// Exactly status->BOMBS distinct mines drawn by weight, none around the
+// prepared first click, like placeMines. Cells are drawn one after another,
+// each in proportion to its weight among the cells still free. False when
+// fewer cells than BOMBS have a positive weight.
+bool placeWeighted(TILE **board, Status *status, Rng *rng, DensitySampler *sampler) {
+    int h = status->H_TILES;
+    if (status->BOMBS > sampler->BASE_COUNT) {
+        return false;
+    }
+
+    initializeBoard(board, status->W_TILES, h);
+    uint64_t *mined = sampler->MINED;
+    memset(mined, 0, (status->W_TILES * h + 63) / 64 * sizeof(uint64_t));
+    const AliasSlot *table = sampler->BASE;
+    int count = sampler->BASE_COUNT;
+    int rejected = 0;
+    sampler->DRAWS = 0;
+    sampler->KEYED = 0;
+
+    // Filling half the cells or more would end up rejecting about every
+    // other draw, so such placements go to the keys from the start
+    int placed = 0;
+    bool alias = status->BOMBS * 2 < count;
+    while (alias && placed < status->BOMBS) {
+        uint64_t r = rngNext(rng);
+        const AliasSlot *slot = &table[((r >> 32) * count) >> 32];
+        int cell = (uint32_t) r < slot->THRESHOLD ? slot->CELL : slot->ALIAS;
+        sampler->DRAWS += 1;
+        if (!(mined[cell >> 6] >> (cell & 63) & 1)) {
+            mined[cell >> 6] |= 1ULL << (cell & 63);
+            board[cell / h][cell % h].TYPE = MINE;
+            placed += 1;
+        } else {
+            rejected += 1;
+        }
+
+        if ((sampler->DRAWS & (ALIAS_WINDOW - 1)) == 0) {
+            if (rejected * 2 > ALIAS_WINDOW) {
+                break;
+            }
+            rejected = 0;
+        }
+    }
+    if (placed < status->BOMBS) {
+        sampler->KEYED = status->BOMBS - placed;
+        placeByKey(board, h, rng, sampler, sampler->KEYED);
+    }
+    generateNumbers(board, status);
+    return true;
+}
@@ -0,0 +1,64 @@
+#ifndef DENSITY_H
+#define DENSITY_H
+
+#include <stdint.h>
+#include "game.h"
+#include "rng.h"
+
+// Relative mine weight of every cell, indexed x * H_TILES + y. A cell of
+// weight 0 never gets a mine. densityFill sets the map; the other builders
+// multiply into it, so a gradient, a noise field and a mask can be stacked.
+typedef struct DensityMap {
+    int W_TILES;
+    int H_TILES;
+    float *WEIGHT;
+} DensityMap;
+
+typedef struct AliasSlot {
+    uint32_t THRESHOLD;     // below it the draw keeps CELL, else takes ALIAS
+    int CELL;
+    int ALIAS;
+} AliasSlot;
+
+typedef struct DensityKey {
+    float KEY;
+    int CELL;
+} DensityKey;
+
+// Walker alias table over the cells that may get a mine. A draw is a
+// single rngNext: the high half picks a slot and the low half decides
+// between its two cells. densityPrepare builds the table for one map and
+// first click once, and every placeWeighted after it starts from that
+// table. Mines are drawn without replacement by rejecting cells that
+// already hold one. Once more than half the draws of a window are
+// rejected, or from the start when the mines take half the cells, the
+// rest come from one pass over the free cells instead: each gets the key
+// -log(u) / weight for a uniform u, and the cells with the smallest keys
+// are mined, which draws them with the same odds as one weighted draw
+// after another (Efraimidis and Spirakis). So a placement never rebuilds
+// the table and touches each cell about once however dense or skewed the
+// map is.
+typedef struct DensitySampler {
+    AliasSlot *BASE;        // prepared table
+    int BASE_COUNT;
+    float *INVERSE;         // 1 / weight of each BASE slot
+    DensityKey *KEYS;
+    double *SCALED;
+    int *WORK;
+    uint64_t *MINED;        // one bit per cell, so rejections stay off the board
+    long DRAWS;             // last placement: alias draws including rejections
+    int KEYED;              // last placement: mines picked by key
+} DensitySampler;
+
+void densityInit(DensityMap *map, Status status);
+void densityFree(DensityMap *map);
+void densityFill(DensityMap *map, float weight);
+void densityGradient(DensityMap *map, float x0, float y0, float from, float x1, float y1, float to);
+void densityNoise(DensityMap *map, Rng *rng, int scale, float contrast);
+void densityMask(DensityMap *map, const unsigned char *mask, float weight);
+void densitySamplerInit(DensitySampler *sampler, Status status);
+void densitySamplerFree(DensitySampler *sampler);
+void densityPrepare(DensitySampler *sampler, const DensityMap *map, int x, int y);
+bool placeWeighted(TILE **board, Status *status, Rng *rng, DensitySampler *sampler);
+
+#endif
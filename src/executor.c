@@ -0,0 +1,153 @@
+#include "executor.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define RANGE(begin, end) ((uint64_t) (begin) << 32 | (uint32_t) (end))
+#define RANGE_BEGIN(range) ((long) ((range) >> 32))
+#define RANGE_END(range) ((long) (uint32_t) (range))
+
+typedef struct Executor {
+    const ExecutorJob *JOB;
+    ExecutorWorker *WORKERS;
+    int THREADS;
+} Executor;
+
+typedef struct ExecutorThread {
+    pthread_t THREAD;
+    Executor *EXECUTOR;
+    int ID;
+} ExecutorThread;
+
+void *arenaAlloc(Arena *arena, size_t bytes) {
+    size_t start = (arena->USED + 15) & ~(size_t) 15;
+    if (start + bytes > arena->SIZE) {
+        return NULL;
+    }
+    arena->USED = start + bytes;
+    return arena->BASE + start;
+}
+
+int executorThreads(void) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    return online > 0 ? (int) online : 1;
+}
+
+// Take the next task from the front of the worker's own range
+static bool takeOwn(ExecutorWorker *worker, long *task) {
+    uint64_t range = atomic_load(&worker->RANGE);
+    while (RANGE_BEGIN(range) < RANGE_END(range)) {
+        if (atomic_compare_exchange_weak(&worker->RANGE, &range, RANGE(RANGE_BEGIN(range) + 1, RANGE_END(range)))) {
+            *task = RANGE_BEGIN(range);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Move the back half of the fullest other range into the thief's own
+static bool steal(Executor *executor, ExecutorWorker *thief) {
+    for (;;) {
+        int victim = -1;
+        long most = 0;
+        for (int i = 0; i < executor->THREADS; i++) {
+            uint64_t range = atomic_load(&executor->WORKERS[i].RANGE);
+            long left = RANGE_END(range) - RANGE_BEGIN(range);
+            if (i != thief->ID && left > most) {
+                most = left;
+                victim = i;
+            }
+        }
+        if (victim < 0) {
+            return false;
+        }
+        ExecutorWorker *from = &executor->WORKERS[victim];
+        uint64_t range = atomic_load(&from->RANGE);
+        long begin = RANGE_BEGIN(range), end = RANGE_END(range);
+        if (begin >= end) {
+            continue;
+        }
+        long middle = begin + (end - begin) / 2;
+        if (atomic_compare_exchange_strong(&from->RANGE, &range, RANGE(begin, middle))) {
+            atomic_store(&thief->RANGE, RANGE(middle, end));
+            thief->STEALS += 1;
+            return true;
+        }
+    }
+}
+
+static void *executorThread(void *arg) {
+    ExecutorThread *thread = arg;
+    Executor *executor = thread->EXECUTOR;
+    ExecutorWorker *worker = &executor->WORKERS[thread->ID];
+    const ExecutorJob *job = executor->JOB;
+    long task;
+    for (;;) {
+        while (takeOwn(worker, &task)) {
+            job->RUN(worker, task, job->CONTEXT);
+            worker->TASKS += 1;
+        }
+        if (!steal(executor, worker)) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+void executorRun(const ExecutorJob *job, int threads, ExecutorStats *stats) {
+    if (threads < 1) {
+        threads = 1;
+    }
+    Executor executor = {job, calloc(threads, sizeof(ExecutorWorker)), threads};
+    ExecutorThread *handles = malloc(threads * sizeof(ExecutorThread));
+
+    for (int i = 0; i < threads; i++) {
+        ExecutorWorker *worker = &executor.WORKERS[i];
+        worker->ID = i;
+        worker->ARENA.SIZE = job->WORKER_SIZE + 16 + job->ARENA_SIZE;
+        worker->ARENA.BASE = malloc(worker->ARENA.SIZE);
+        worker->STATE = arenaAlloc(&worker->ARENA, job->WORKER_SIZE);
+        memset(worker->STATE, 0, job->WORKER_SIZE);
+        atomic_init(&worker->RANGE, RANGE(job->TASKS * i / threads, job->TASKS * (i + 1) / threads));
+        if (job->INIT != NULL) {
+            job->INIT(worker, job->CONTEXT);
+        }
+    }
+
+    for (int i = 0; i < threads; i++) {
+        handles[i] = (ExecutorThread) {.EXECUTOR = &executor, .ID = i};
+    }
+    for (int i = 1; i < threads; i++) {
+        if (pthread_create(&handles[i].THREAD, NULL, executorThread, &handles[i]) != 0) {
+            handles[i].EXECUTOR = NULL;     // its range is stolen by the others
+        }
+    }
+    executorThread(&handles[0]);
+    for (int i = 1; i < threads; i++) {
+        if (handles[i].EXECUTOR != NULL) {
+            pthread_join(handles[i].THREAD, NULL);
+        }
+    }
+
+    if (stats != NULL) {
+        *stats = (ExecutorStats) {.THREADS = threads, .LEAST_TASKS = job->TASKS};
+    }
+    for (int i = 0; i < threads; i++) {
+        ExecutorWorker *worker = &executor.WORKERS[i];
+        if (job->MERGE != NULL) {
+            job->MERGE(worker, job->CONTEXT);
+        }
+        if (job->FREE != NULL) {
+            job->FREE(worker, job->CONTEXT);
+        }
+        if (stats != NULL) {
+            stats->STEALS += worker->STEALS;
+            if (worker->TASKS > stats->MOST_TASKS) stats->MOST_TASKS = worker->TASKS;
+            if (worker->TASKS < stats->LEAST_TASKS) stats->LEAST_TASKS = worker->TASKS;
+        }
+        free(worker->ARENA.BASE);
+    }
+    free(handles);
+    free(executor.WORKERS);
+}
@@ -0,0 +1,55 @@
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Bump allocator owned by one worker; nothing is freed on its own, the
+// whole arena goes at once
+typedef struct Arena {
+    unsigned char *BASE;
+    size_t SIZE;
+    size_t USED;
+} Arena;
+
+typedef struct ExecutorWorker {
+    int ID;
+    void *STATE;            // WORKER_SIZE zeroed bytes from ARENA, set up by INIT
+    Arena ARENA;
+    _Atomic uint64_t RANGE; // tasks still owned: begin << 32 | end
+    long TASKS;             // tasks this worker ran
+    long STEALS;            // successful steals by this worker
+} ExecutorWorker;
+
+// Tasks 0 .. TASKS - 1 are split evenly over the workers up front. A worker
+// runs its own range from the front; once it is empty it steals the back
+// half of the fullest range it can find, so a few slow tasks do not leave
+// the other threads idle. Ranges are single 64-bit words changed by
+// compare-and-swap only, which caps a job at 2^32 - 1 tasks. After every
+// thread has joined, MERGE folds each worker's state into the caller's
+// result in worker order, so no result is ever shared while the job runs.
+typedef struct ExecutorJob {
+    long TASKS;
+    size_t WORKER_SIZE;
+    size_t ARENA_SIZE;      // per worker, on top of WORKER_SIZE
+    void *CONTEXT;          // shared, read only while running
+    void (*INIT)(ExecutorWorker *worker, void *context);
+    void (*RUN)(ExecutorWorker *worker, long task, void *context);
+    void (*MERGE)(ExecutorWorker *worker, void *context);
+    void (*FREE)(ExecutorWorker *worker, void *context);
+} ExecutorJob;
+
+typedef struct ExecutorStats {
+    int THREADS;
+    long STEALS;
+    long MOST_TASKS;        // busiest worker
+    long LEAST_TASKS;
+} ExecutorStats;
+
+void *arenaAlloc(Arena *arena, size_t bytes);
+int executorThreads(void);
+void executorRun(const ExecutorJob *job, int threads, ExecutorStats *stats);
+
+#endif
@@ -0,0 +1,91 @@
+#include "frontier.h"
+#include <stdlib.h>
+#include <string.h>
+
+void frontierInit(Frontier *frontier, Status status) {
+    int cells = status.W_TILES * status.H_TILES;
+    frontier->W_TILES = status.W_TILES;
+    frontier->H_TILES = status.H_TILES;
+    frontier->HIDDEN = malloc(cells);
+    frontier->FLAGGED = malloc(cells);
+    frontier->SLOT = malloc(cells * sizeof(int));
+    frontier->MEMBERS = malloc(cells * sizeof(int));
+    frontier->COUNT = 0;
+}
+
+void frontierFree(Frontier *frontier) {
+    free(frontier->HIDDEN);
+    free(frontier->FLAGGED);
+    free(frontier->SLOT);
+    free(frontier->MEMBERS);
+    frontier->HIDDEN = NULL;
+    frontier->FLAGGED = NULL;
+    frontier->SLOT = NULL;
+    frontier->MEMBERS = NULL;
+}
+
+static void refresh(Frontier *frontier, TILE **board, int x, int y) {
+    int i = x * frontier->H_TILES + y;
+    bool member = board[x][y].VISIBLE && board[x][y].TYPE == NUMBER && frontier->HIDDEN[i] > 0;
+    if (member && frontier->SLOT[i] < 0) {
+        frontier->SLOT[i] = frontier->COUNT;
+        frontier->MEMBERS[frontier->COUNT++] = i;
+    } else if (!member && frontier->SLOT[i] >= 0) {
+        // Swap the last member into the hole
+        int last = frontier->MEMBERS[--frontier->COUNT];
+        frontier->MEMBERS[frontier->SLOT[i]] = last;
+        frontier->SLOT[last] = frontier->SLOT[i];
+        frontier->SLOT[i] = -1;
+    }
+}
+
+void frontierBuild(Frontier *frontier, TILE **board, Status status) {
+    int w = status.W_TILES, h = status.H_TILES;
+    memset(frontier->HIDDEN, 0, w * h);
+    memset(frontier->FLAGGED, 0, w * h);
+    frontier->COUNT = 0;
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) {
+            frontier->SLOT[x * h + y] = -1;
+            if (board[x][y].VISIBLE) {
+                continue;
+            }
+            bool flagged = board[x][y].MARK == CELL_FLAGGED;
+            for (int nx = x - 1; nx <= x + 1; nx++) {
+                for (int ny = y - 1; ny <= y + 1; ny++) {
+                    if (nx >= 0 && nx < w && ny >= 0 && ny < h && (nx != x || ny != y)) {
+                        frontier->HIDDEN[nx * h + ny] += 1;
+                        frontier->FLAGGED[nx * h + ny] += flagged;
+                    }
+                }
+            }
+        }
+    }
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) {
+            refresh(frontier, board, x, y);
+        }
+    }
+}
+
+// Call after board[x][y] changed, with its visibility and mark from before
+void frontierChange(Frontier *frontier, TILE **board, int x, int y, bool wasVisible, CellMark wasMark) {
+    int h = frontier->H_TILES;
+    int hidden = !board[x][y].VISIBLE - !wasVisible;
+    int flagged = (!board[x][y].VISIBLE && board[x][y].MARK == CELL_FLAGGED) - (!wasVisible && wasMark == CELL_FLAGGED);
+    if (hidden == 0 && flagged == 0) {
+        return;
+    }
+    for (int nx = x - 1; nx <= x + 1; nx++) {
+        for (int ny = y - 1; ny <= y + 1; ny++) {
+            if (nx < 0 || nx >= frontier->W_TILES || ny < 0 || ny >= h) {
+                continue;
+            }
+            if (nx != x || ny != y) {
+                frontier->HIDDEN[nx * h + ny] += hidden;
+                frontier->FLAGGED[nx * h + ny] += flagged;
+            }
+            refresh(frontier, board, nx, ny);
+        }
+    }
+}
@@ -0,0 +1,26 @@
+#ifndef FRONTIER_H
+#define FRONTIER_H
+
+#include "game.h"
+
+// Revealed numbers that still border a hidden cell. Reveals and marks keep
+// it current through FloodWork.FRONTIER; undo, redo and loads rebuild it.
+// MEMBERS is dense and SLOT maps a cell back into it, so insert and erase
+// are O(1) and a walk over the frontier never touches the rest of the board.
+// Cells are indexed x * H_TILES + y.
+typedef struct Frontier {
+    int W_TILES;
+    int H_TILES;
+    unsigned char *HIDDEN;      // hidden neighbours of each cell
+    unsigned char *FLAGGED;     // flagged hidden neighbours of each cell
+    int *SLOT;                  // position in MEMBERS, -1 when absent
+    int *MEMBERS;
+    int COUNT;
+} Frontier;
+
+void frontierInit(Frontier *frontier, Status status);
+void frontierFree(Frontier *frontier);
+void frontierBuild(Frontier *frontier, TILE **board, Status status);
+void frontierChange(Frontier *frontier, TILE **board, int x, int y, bool wasVisible, CellMark wasMark);
+
+#endif
@@ -0,0 +1,284 @@
+#include "game.h"
+#include "frontier.h"
+#include "topology.h"
+#include <stdlib.h>
+
+static const int directions[8][2] = {
+        {-1, -1}, {-1, 0}, {-1, 1},
+        { 0, -1},          { 0, 1},
+        { 1, -1}, { 1, 0}, { 1, 1}
+};
+
+TILE **allocBoard(int width, int height) {
+    TILE **board = malloc(width * sizeof(TILE *));
+    for (int i = 0; i < width; i++) {
+        board[i] = malloc(height * sizeof(TILE));
+    }
+    return board;
+}
+
+void initializeBoard(TILE **board, int width, int height) {
+    for (int i = 0; i < width; i++) {
+        for (int j = 0; j < height; j++) {
+            board[i][j].TYPE = BLANK_TILE;
+            board[i][j].AMOUNT = 0;
+            board[i][j].VISIBLE = false;
+            board[i][j].MARK = CELL_CLEARED;
+        }
+    }
+}
+
+void freeMem(Status status, TILE **board) {
+    for (int i = 0; i < status.W_TILES; i++) {
+        free(board[i]);
+    }
+    free(board);
+}
+
+void generateBombs(TILE **board, int count, Status status) {
+    int x, y;
+
+    for (int i = 0; i < count; i++) {
+        x = rand() % status.W_TILES;
+        y = rand() % status.H_TILES;
+        board[x][y].TYPE = MINE;
+    }
+}
+
+// Counts from scratch, so any AMOUNT left on the board is overwritten
+void generateNumbers(TILE **board, Status *status) {
+    topologyNumbers(TOPOLOGY_SQUARE, board, status);
+}
+
+// Add one to every non-mine neighbour of (x, y), or subtract with delta -1
+static void adjustAround(TILE **board, int x, int y, Status status, int delta) {
+    for (int d = 0; d < 8; d++) {
+        int newX = x + directions[d][0];
+        int newY = y + directions[d][1];
+        if (newX >= 0 && newX < status.W_TILES && newY >= 0 && newY < status.H_TILES && board[newX][newY].TYPE != MINE) {
+            board[newX][newY].AMOUNT += delta;
+            board[newX][newY].TYPE = board[newX][newY].AMOUNT ? NUMBER : BLANK_TILE;
+        }
+    }
+}
+
+// Turn a safe cell into a mine, keeping every number current by touching
+// only its 3x3. status.BOMBS is left to the caller.
+void addMine(TILE **board, int x, int y, Status status) {
+    if (board[x][y].TYPE == MINE) {
+        return;
+    }
+    board[x][y].TYPE = MINE;
+    board[x][y].AMOUNT = 0;
+    adjustAround(board, x, y, status, 1);
+}
+
+// Turn a mine into a safe cell numbered from its neighbours, the inverse of
+// addMine
+void removeMine(TILE **board, int x, int y, Status status) {
+    if (board[x][y].TYPE != MINE) {
+        return;
+    }
+    int amount = 0;
+    for (int d = 0; d < 8; d++) {
+        int newX = x + directions[d][0];
+        int newY = y + directions[d][1];
+        amount += newX >= 0 && newX < status.W_TILES && newY >= 0 && newY < status.H_TILES
+                  && board[newX][newY].TYPE == MINE;
+    }
+    board[x][y].AMOUNT = amount;
+    board[x][y].TYPE = amount ? NUMBER : BLANK_TILE;
+    adjustAround(board, x, y, status, -1);
+}
+
+// A random cell that is (mine) or is not (!mine) a mine and lies more than
+// clear cells from (x, y). Random probes first, then a scan from a random
+// start, so a crowded board still finds the last one. -1 when none.
+static int pickCell(TILE **board, int x, int y, Status status, bool mine, int clear) {
+    int cells = status.W_TILES * status.H_TILES;
+    int start = rand() % cells;
+    for (int k = 0; k < cells + 32; k++) {
+        int cell = k < 32 ? rand() % cells : (start + k - 32) % cells;
+        int cx = cell / status.H_TILES, cy = cell % status.H_TILES;
+        if ((board[cx][cy].TYPE == MINE) == mine && (abs(cx - x) > clear || abs(cy - y) > clear)) {
+            return cell;
+        }
+    }
+    return -1;
+}
+
+// Make the first click land on the wanted kind of cell by moving mines
+// instead of dealing new boards: for BLANK_TILE every mine in the click's
+// 3x3 moves out of it, for NUMBER a mine under the click moves away and a
+// blank click pulls one mine in next to it. Each move costs two 3x3
+// updates. Returns false when the board is too full to comply.
+bool settleFirstCell(TILE **board, int x, int y, Status status, CellType want) {
+    if (want == BLANK_TILE) {
+        for (int nx = x - 1; nx <= x + 1; nx++) {
+            for (int ny = y - 1; ny <= y + 1; ny++) {
+                if (nx < 0 || nx >= status.W_TILES || ny < 0 || ny >= status.H_TILES || board[nx][ny].TYPE != MINE) {
+                    continue;
+                }
+                int cell = pickCell(board, x, y, status, false, 1);
+                if (cell < 0) {
+                    return false;
+                }
+                removeMine(board, nx, ny, status);
+                addMine(board, cell / status.H_TILES, cell % status.H_TILES, status);
+            }
+        }
+    } else if (want == NUMBER) {
+        if (board[x][y].TYPE == MINE) {
+            int cell = pickCell(board, x, y, status, false, 0);
+            if (cell < 0) {
+                return false;
+            }
+            removeMine(board, x, y, status);
+            addMine(board, cell / status.H_TILES, cell % status.H_TILES, status);
+        }
+        if (board[x][y].TYPE == BLANK_TILE) {
+            // Any mine will do; it lands on a random neighbour inside the
+            // board, so no side of the click is more likely to hold it
+            int from = pickCell(board, x, y, status, true, 1);
+            int inside[8], count = 0;
+            for (int d = 0; d < 8; d++) {
+                int nx = x + directions[d][0], ny = y + directions[d][1];
+                if (nx >= 0 && nx < status.W_TILES && ny >= 0 && ny < status.H_TILES) {
+                    inside[count++] = d;
+                }
+            }
+            if (from < 0 || count == 0) {
+                return false;
+            }
+            int d = inside[rand() % count];
+            removeMine(board, from / status.H_TILES, from % status.H_TILES, status);
+            addMine(board, x + directions[d][0], y + directions[d][1], status);
+        }
+    }
+    return board[x][y].TYPE == want || want == ANY;
+}
+
+void freeFloodWork(FloodWork *work) {
+    free(work->STACK);
+    free(work->CHANGES);
+    work->STACK = NULL;
+    work->CHANGES = NULL;
+    work->COUNT = 0;
+    work->CAPACITY = 0;
+    work->CHANGE_COUNT = 0;
+    work->CHANGE_CAPACITY = 0;
+}
+
+void recordCellChange(FloodWork *work, int index, const TILE *tile) {
+    if (!work->RECORD) {
+        return;
+    }
+    if (work->CHANGE_COUNT == work->CHANGE_CAPACITY) {
+        work->CHANGE_CAPACITY = work->CHANGE_CAPACITY ? work->CHANGE_CAPACITY * 2 : 64;
+        work->CHANGES = realloc(work->CHANGES, work->CHANGE_CAPACITY * sizeof(unsigned int));
+    }
+    work->CHANGES[work->CHANGE_COUNT++] = (unsigned int) index << 4 | tile->MARK << 1 | tile->VISIBLE;
+}
+
+static void pushCell(FloodWork *work, int x, int y) {
+    if (work->COUNT == work->CAPACITY) {
+        work->CAPACITY = work->CAPACITY ? work->CAPACITY * 2 : 64;
+        work->STACK = realloc(work->STACK, work->CAPACITY * 2 * sizeof(int));
+    }
+    work->STACK[work->COUNT * 2] = x;
+    work->STACK[work->COUNT * 2 + 1] = y;
+    work->COUNT += 1;
+}
+
+static void drainFlood(TILE **board, Status *status, FloodWork *work) {
+    while (work->COUNT > 0) {
+        work->COUNT -= 1;
+        int x = work->STACK[work->COUNT * 2];
+        int y = work->STACK[work->COUNT * 2 + 1];
+
+        if (board[x][y].VISIBLE || board[x][y].MARK == CELL_FLAGGED) {
+            continue;
+        }
+
+        recordCellChange(work, x * status->H_TILES + y, &board[x][y]);
+        board[x][y].VISIBLE = true;
+        status->VISIBLE_TILES += 1;
+        if (work->FRONTIER != NULL) {
+            frontierChange(work->FRONTIER, board, x, y, false, board[x][y].MARK);
+        }
+
+        if (board[x][y].TYPE == MINE) {
+            board[x][y].TYPE = MINE_EXPLOSION;
+            status->STATE = LOSE;
+            continue;
+        }
+
+        if (status->STATE != LOSE && (status->VISIBLE_TILES + status->BOMBS) == (status->W_TILES * status->H_TILES)) {
+            status->STATE = WIN;
+        }
+
+        if (board[x][y].TYPE == NUMBER) {
+            continue;
+        }
+
+        for (int d = 0; d < 8; d++) {
+            int newX = x + directions[d][0];
+            int newY = y + directions[d][1];
+            if (newX >= 0 && newX < status->W_TILES && newY >= 0 && newY < status->H_TILES
+                && !board[newX][newY].VISIBLE && board[newX][newY].MARK != CELL_FLAGGED) {
+                pushCell(work, newX, newY);
+            }
+        }
+    }
+}
+
+void revealEmptyCells(TILE **board, int x, int y, Status *status, FloodWork *work) {
+    if (x < 0 || x >= status->W_TILES || y < 0 || y >= status->H_TILES) {
+        return;
+    }
+    pushCell(work, x, y);
+    drainFlood(board, status, work);
+}
+
+bool chordCell(TILE **board, int x, int y, Status *status, FloodWork *work) {
+    if (!board[x][y].VISIBLE || board[x][y].TYPE != NUMBER) {
+        return false;
+    }
+
+    int flagged = 0;
+    for (int d = 0; d < 8; d++) {
+        int newX = x + directions[d][0];
+        int newY = y + directions[d][1];
+        if (newX >= 0 && newX < status->W_TILES && newY >= 0 && newY < status->H_TILES
+            && !board[newX][newY].VISIBLE && board[newX][newY].MARK == CELL_FLAGGED) {
+            flagged += 1;
+        }
+    }
+    if (flagged != board[x][y].AMOUNT) {
+        return false;
+    }
+
+    for (int d = 0; d < 8; d++) {
+        int newX = x + directions[d][0];
+        int newY = y + directions[d][1];
+        if (newX >= 0 && newX < status->W_TILES && newY >= 0 && newY < status->H_TILES
+            && !board[newX][newY].VISIBLE && board[newX][newY].MARK != CELL_FLAGGED) {
+            pushCell(work, newX, newY);
+        }
+    }
+    drainFlood(board, status, work);
+    return true;
+}
+
+void markCell(TILE **board, int x, int y, Status status, FloodWork *work) {
+    recordCellChange(work, x * status.H_TILES + y, &board[x][y]);
+    CellMark before = board[x][y].MARK;
+    if (status.STATE == PLAYING && !board[x][y].VISIBLE) {
+        board[x][y].MARK = (board[x][y].MARK + 1) % 3;
+    } else {
+        board[x][y].MARK = CELL_CLEARED;
+    }
+    if (work->FRONTIER != NULL) {
+        frontierChange(work->FRONTIER, board, x, y, board[x][y].VISIBLE, before);
+    }
+}
@@ -0,0 +1,76 @@
+#ifndef GAME_H
+#define GAME_H
+
+#include <stdbool.h>
+
+typedef enum State {
+    START,
+    PLAYING,
+    WIN,
+    LOSE
+} State;
+
+typedef enum CellMark {
+    CELL_CLEARED,
+    CELL_FLAGGED,
+    CELL_QUESTIONED
+} CellMark;
+
+typedef enum CellType {
+    BLANK_TILE,
+    NUMBER,
+    MINE,
+    MINE_EXPLOSION,
+    ANY
+} CellType;
+
+typedef struct TILE {
+    CellType TYPE;
+    int AMOUNT;
+    CellMark MARK;
+    bool VISIBLE;
+} TILE;
+
+typedef struct Status {
+    int WIDTH;
+    int HEIGHT;
+    int W_TILES;
+    int H_TILES;
+    int TILE;
+    int BOMBS;
+    int VISIBLE_TILES;
+    State STATE;
+    CellType FIRST_CELL;
+    bool NO_GUESS;
+} Status;
+
+// Pending cells of a flood fill, kept between calls so reveals do not allocate.
+// While RECORD is set every cell a reveal or mark touches is appended to
+// CHANGES as index << 4 | previous MARK << 1 | previous VISIBLE. A non-NULL
+// FRONTIER is kept up to date by every reveal and mark.
+typedef struct FloodWork {
+    int *STACK;
+    int COUNT;
+    int CAPACITY;
+    unsigned int *CHANGES;
+    int CHANGE_COUNT;
+    int CHANGE_CAPACITY;
+    bool RECORD;
+    struct Frontier *FRONTIER;
+} FloodWork;
+
+TILE **allocBoard(int width, int height);
+void initializeBoard(TILE **board, int width, int height);
+void freeMem(Status status, TILE **board);
+void generateBombs(TILE **board, int count, Status status);
+void generateNumbers(TILE **board, Status *status);
+void addMine(TILE **board, int x, int y, Status status);
+void removeMine(TILE **board, int x, int y, Status status);
+bool settleFirstCell(TILE **board, int x, int y, Status status, CellType want);
+void freeFloodWork(FloodWork *work);
+void recordCellChange(FloodWork *work, int index, const TILE *tile);
+void revealEmptyCells(TILE **board, int x, int y, Status *status, FloodWork *work);
+bool chordCell(TILE **board, int x, int y, Status *status, FloodWork *work);
+void markCell(TILE **board, int x, int y, Status status, FloodWork *work);
+
+#endif
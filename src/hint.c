@@ -0,0 +1,185 @@
+#include "hint.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static double hintClock(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+static void hintJoin(Hint *hint) {
+    if (hint->JOINABLE) {
+        pthread_join(hint->THREAD, NULL);
+        hint->JOINABLE = false;
+    }
+}
+
+void hintInit(Hint *hint, Status status) {
+    int cells = status.W_TILES * status.H_TILES;
+    hint->CELL = -1;
+    hint->SAFE = false;
+    hint->RISK = 0;
+    hint->GENERATION = 0;
+    hint->SECONDS = 0;
+    hint->WORST_SECONDS = 0;
+    hint->SYNC_CELLS = 1 << 14;
+    solverInit(&hint->SOLVER, status);
+    probabilityInit(&hint->PROBABILITY, status);
+    // A tangled component past this budget counts as unconstrained: a
+    // slightly worse guess, but the answer stays inside one frame
+    hint->PROBABILITY.NODE_BUDGET = 50000;
+    probabilityCacheInit(&hint->CACHE, 256, 4 << 20);
+    hint->PROBABILITY.CACHE = &hint->CACHE;
+    hint->BOARD = NULL;
+    hint->MEMBERS = NULL;
+    hint->DIRTY = NULL;
+    hint->DIRTY_COUNT = 0;
+    hint->STALE = true;
+    if (cells > hint->SYNC_CELLS) {
+        // Touched now, so the first full copy does not also fault the pages in
+        hint->BOARD = allocBoard(status.W_TILES, status.H_TILES);
+        initializeBoard(hint->BOARD, status.W_TILES, status.H_TILES);
+        hint->MEMBERS = malloc(cells * sizeof(int));
+        hint->DIRTY = malloc(cells * sizeof(int));
+        denseBitmapInit(&hint->DIRTY_CELLS, status.W_TILES, status.H_TILES);
+    }
+    hint->STATUS = status;
+    hint->MEMBER_COUNT = 0;
+    hint->JOINABLE = false;
+    atomic_init(&hint->STATE, HINT_IDLE);
+}
+
+void hintFree(Hint *hint) {
+    hintJoin(hint);
+    solverFree(&hint->SOLVER);
+    probabilityFree(&hint->PROBABILITY);
+    probabilityCacheFree(&hint->CACHE);
+    if (hint->BOARD != NULL) {
+        freeMem(hint->STATUS, hint->BOARD);
+        denseBitmapFree(&hint->DIRTY_CELLS);
+        hint->BOARD = NULL;
+    }
+    free(hint->MEMBERS);
+    free(hint->DIRTY);
+    hint->MEMBERS = NULL;
+    hint->DIRTY = NULL;
+}
+
+// Safe while a request runs: the worker never reads the dirty list
+void hintTrack(Hint *hint, const FloodWork *work) {
+    if (hint->BOARD == NULL || hint->STALE) {
+        return;
+    }
+    int h = hint->STATUS.H_TILES;
+    for (int c = 0; c < work->CHANGE_COUNT; c++) {
+        int cell = (int) (work->CHANGES[c] >> 4);
+        if (!denseBitmapTest(&hint->DIRTY_CELLS, cell / h, cell % h)) {
+            denseBitmapSet(&hint->DIRTY_CELLS, cell / h, cell % h);
+            hint->DIRTY[hint->DIRTY_COUNT++] = cell;
+        }
+    }
+}
+
+void hintInvalidate(Hint *hint) {
+    hint->STALE = true;
+}
+
+// Brings the snapshot up to the live board, cell by cell when few changed
+static void hintSnapshot(Hint *hint, TILE **board, Status status) {
+    int h = status.H_TILES;
+    if (hint->STALE || hint->DIRTY_COUNT > status.W_TILES * h / 8) {
+        for (int x = 0; x < status.W_TILES; x++) {
+            memcpy(hint->BOARD[x], board[x], h * sizeof(TILE));
+        }
+        denseBitmapClearAll(&hint->DIRTY_CELLS);
+    } else {
+        for (int i = 0; i < hint->DIRTY_COUNT; i++) {
+            int x = hint->DIRTY[i] / h, y = hint->DIRTY[i] % h;
+            hint->BOARD[x][y] = board[x][y];
+            denseBitmapReset(&hint->DIRTY_CELLS, x, y);
+        }
+    }
+    hint->DIRTY_COUNT = 0;
+    hint->STALE = false;
+    hint->STATUS = status;
+}
+
+// Logic seeded from the frontier only, then probabilities if it finds nothing
+static void solveHint(Hint *hint, TILE **board, Status status, const int *members, int count) {
+    Solver *solver = &hint->SOLVER;
+    int h = status.H_TILES;
+    solverReset(solver);
+    for (int i = 0; i < count; i++) {
+        solverTouch(solver, board, members[i] / h, members[i] % h);
+    }
+    solverRun(solver, board, status);
+    if (solver->SAFE_COUNT > 0) {
+        hint->CELL = solver->SAFE[0];
+        hint->SAFE = true;
+        hint->RISK = 0;
+        return;
+    }
+
+    computeProbabilities(&hint->PROBABILITY, board, status, solver);
+    const float *prob = hint->PROBABILITY.PROB;
+    hint->CELL = -1;
+    hint->SAFE = false;
+    for (int i = 0; i < status.W_TILES * h; i++) {
+        if (prob[i] >= 0 && solver->KNOWN[i] == KNOWN_NOTHING && board[i / h][i % h].MARK != CELL_FLAGGED
+            && (hint->CELL < 0 || prob[i] < prob[hint->CELL])) {
+            hint->CELL = i;
+        }
+    }
+    hint->RISK = hint->CELL >= 0 ? prob[hint->CELL] : 0;
+}
+
+static void *hintWorker(void *arg) {
+    Hint *hint = arg;
+    solveHint(hint, hint->BOARD, hint->STATUS, hint->MEMBERS, hint->MEMBER_COUNT);
+    hint->FINISHED = hintClock();
+    atomic_store(&hint->STATE, HINT_READY);
+    return NULL;
+}
+
+// Returns false while an earlier request is still running
+bool hintRequest(Hint *hint, TILE **board, Status status, const Frontier *frontier, unsigned int generation) {
+    if (atomic_load(&hint->STATE) == HINT_RUNNING) {
+        return false;
+    }
+    hintJoin(hint);
+    hint->GENERATION = generation;
+    hint->STARTED = hintClock();
+
+    if (hint->BOARD == NULL) {
+        solveHint(hint, board, status, frontier->MEMBERS, frontier->COUNT);
+        hint->FINISHED = hintClock();
+        atomic_store(&hint->STATE, HINT_READY);
+        return true;
+    }
+
+    hintSnapshot(hint, board, status);
+    memcpy(hint->MEMBERS, frontier->MEMBERS, frontier->COUNT * sizeof(int));
+    hint->MEMBER_COUNT = frontier->COUNT;
+    atomic_store(&hint->STATE, HINT_RUNNING);
+    hint->JOINABLE = pthread_create(&hint->THREAD, NULL, hintWorker, hint) == 0;
+    if (!hint->JOINABLE) {
+        hintWorker(hint);
+    }
+    return true;
+}
+
+// True once per finished request; CELL, SAFE, RISK and SECONDS are then current
+bool hintPoll(Hint *hint) {
+    if (atomic_load(&hint->STATE) != HINT_READY) {
+        return false;
+    }
+    hintJoin(hint);
+    atomic_store(&hint->STATE, HINT_IDLE);
+    hint->SECONDS = hint->FINISHED - hint->STARTED;
+    if (hint->SECONDS > hint->WORST_SECONDS) {
+        hint->WORST_SECONDS = hint->SECONDS;
+    }
+    return true;
+}
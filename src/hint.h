@@ -0,0 +1,62 @@
+#ifndef HINT_H
+#define HINT_H
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "game.h"
+#include "bitmap.h"
+#include "frontier.h"
+#include "solver.h"
+#include "probability.h"
+
+typedef enum HintState {
+    HINT_IDLE,
+    HINT_RUNNING,
+    HINT_READY
+} HintState;
+
+// A provably safe cell, or the lowest risk one when logic alone is stuck.
+// Boards up to SYNC_CELLS are answered inside hintRequest; larger ones are
+// copied and solved on a worker thread so the render loop keeps going, and
+// hintPoll reports when the answer lands. GENERATION echoes the caller's
+// move counter so a hint for an older position can be told apart.
+//
+// The copy is kept up to date a move at a time: hintTrack takes the cells a
+// move recorded in its change log, and the next request copies only those.
+// After anything that changes the board without a change log, such as a
+// new deal, an undo or a restore, hintInvalidate makes the next request
+// copy the whole board.
+typedef struct Hint {
+    int CELL;               // x * H_TILES + y, -1 when nothing is hidden
+    bool SAFE;
+    float RISK;             // mine probability of CELL
+    unsigned int GENERATION;
+    double SECONDS;         // request to answer, last hint
+    double WORST_SECONDS;
+    int SYNC_CELLS;
+    Solver SOLVER;
+    Probability PROBABILITY;
+    ProbabilityCache CACHE;
+    TILE **BOARD;           // async snapshot
+    int *DIRTY;             // cells changed since the snapshot, each once
+    int DIRTY_COUNT;
+    DenseBitmap DIRTY_CELLS;
+    bool STALE;             // the snapshot must be copied whole
+    Status STATUS;
+    int *MEMBERS;           // async snapshot of the frontier
+    int MEMBER_COUNT;
+    double STARTED;
+    double FINISHED;
+    pthread_t THREAD;
+    bool JOINABLE;
+    atomic_int STATE;
+} Hint;
+
+void hintInit(Hint *hint, Status status);
+void hintFree(Hint *hint);
+void hintTrack(Hint *hint, const FloodWork *work);
+void hintInvalidate(Hint *hint);
+bool hintRequest(Hint *hint, TILE **board, Status status, const Frontier *frontier, unsigned int generation);
+bool hintPoll(Hint *hint);
+
+#endif
@@ -0,0 +1,120 @@
+#include "history.h"
+#include <stdlib.h>
+
+void historyInit(History *history, long maxSteps, long maxChanges) {
+    history->LOG = malloc(maxChanges * sizeof(uint64_t));
+    history->LOG_CAPACITY = maxChanges;
+    history->STEPS = malloc(maxSteps * sizeof(HistoryStep));
+    history->STEP_CAPACITY = maxSteps;
+    historyClear(history);
+}
+
+void historyFree(History *history) {
+    free(history->LOG);
+    free(history->STEPS);
+    history->LOG = NULL;
+    history->STEPS = NULL;
+}
+
+void historyClear(History *history) {
+    history->LOG_END = 0;
+    history->FIRST = 0;
+    history->CURRENT = 0;
+    history->LAST = 0;
+}
+
+void historyBegin(History *history, Status status, FloodWork *work) {
+    history->VISIBLE_BEFORE = status.VISIBLE_TILES;
+    history->STATE_BEFORE = status.STATE;
+    work->CHANGE_COUNT = 0;
+    work->RECORD = true;
+}
+
+void historyCommit(History *history, TILE **board, Status status, FloodWork *work) {
+    work->RECORD = false;
+    int count = work->CHANGE_COUNT;
+    if (count == 0 && status.STATE == history->STATE_BEFORE) {
+        return;
+    }
+    if (count > history->LOG_CAPACITY) {
+        historyClear(history);
+        return;
+    }
+
+    // A new action discards the redo branch
+    history->LAST = history->CURRENT;
+    if (history->CURRENT > history->FIRST) {
+        HistoryStep *last = &history->STEPS[(history->CURRENT - 1) % history->STEP_CAPACITY];
+        history->LOG_END = last->START + last->COUNT;
+    }
+
+    while (history->LAST > history->FIRST
+           && (history->LAST - history->FIRST >= history->STEP_CAPACITY
+               || history->LOG_END + count - history->STEPS[history->FIRST % history->STEP_CAPACITY].START > history->LOG_CAPACITY)) {
+        history->FIRST += 1;
+    }
+
+    HistoryStep *step = &history->STEPS[history->LAST % history->STEP_CAPACITY];
+    step->START = history->LOG_END;
+    step->COUNT = count;
+    step->VISIBLE_BEFORE = history->VISIBLE_BEFORE;
+    step->VISIBLE_AFTER = status.VISIBLE_TILES;
+    step->STATE_BEFORE = history->STATE_BEFORE;
+    step->STATE_AFTER = status.STATE;
+
+    int h = status.H_TILES;
+    for (int i = 0; i < count; i++) {
+        unsigned int change = work->CHANGES[i];
+        const TILE *tile = &board[(change >> 4) / h][(change >> 4) % h];
+        uint64_t after = tile->MARK << 1 | tile->VISIBLE;
+        history->LOG[(history->LOG_END + i) % history->LOG_CAPACITY] = after << 32 | change;
+    }
+    history->LOG_END += count;
+    history->LAST += 1;
+    history->CURRENT = history->LAST;
+}
+
+static void applyCell(TILE **board, int h, unsigned int index, unsigned int state) {
+    TILE *tile = &board[index / h][index % h];
+    tile->MARK = (state >> 1) & 3;
+    tile->VISIBLE = state & 1;
+    if (tile->VISIBLE && tile->TYPE == MINE) {
+        tile->TYPE = MINE_EXPLOSION;
+    } else if (!tile->VISIBLE && tile->TYPE == MINE_EXPLOSION) {
+        tile->TYPE = MINE;
+    }
+}
+
+bool historyUndo(History *history, TILE **board, Status *status) {
+    if (history->CURRENT == history->FIRST) {
+        return false;
+    }
+    history->CURRENT -= 1;
+    const HistoryStep *step = &history->STEPS[history->CURRENT % history->STEP_CAPACITY];
+    for (int i = step->COUNT - 1; i >= 0; i--) {
+        uint64_t entry = history->LOG[(step->START + i) % history->LOG_CAPACITY];
+        applyCell(board, status->H_TILES, (uint32_t) entry >> 4, entry & 7);
+    }
+    status->VISIBLE_TILES = step->VISIBLE_BEFORE;
+    status->STATE = step->STATE_BEFORE;
+    return true;
+}
+
+bool historyRedo(History *history, TILE **board, Status *status) {
+    if (history->CURRENT == history->LAST) {
+        return false;
+    }
+    const HistoryStep *step = &history->STEPS[history->CURRENT % history->STEP_CAPACITY];
+    for (int i = 0; i < step->COUNT; i++) {
+        uint64_t entry = history->LOG[(step->START + i) % history->LOG_CAPACITY];
+        applyCell(board, status->H_TILES, (uint32_t) entry >> 4, (entry >> 32) & 7);
+    }
+    status->VISIBLE_TILES = step->VISIBLE_AFTER;
+    status->STATE = step->STATE_AFTER;
+    history->CURRENT += 1;
+    return true;
+}
+
+size_t historyBytes(const History *history) {
+    return sizeof(History) + history->LOG_CAPACITY * sizeof(uint64_t) + history->STEP_CAPACITY * sizeof(HistoryStep);
+}
@@ -0,0 +1,44 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "game.h"
+
+// One undoable action: a slice of the delta log plus the Status header
+// fields a reveal can change. Positions are absolute and wrap in the rings.
+typedef struct HistoryStep {
+    long START;
+    int COUNT;
+    int VISIBLE_BEFORE;
+    int VISIBLE_AFTER;
+    State STATE_BEFORE;
+    State STATE_AFTER;
+} HistoryStep;
+
+// Each log entry packs a FloodWork change word in the low 32 bits and the
+// cell's new MARK << 1 | VISIBLE above it. Both rings are fixed size, so the
+// oldest steps are dropped once a long game outgrows them.
+typedef struct History {
+    uint64_t *LOG;
+    long LOG_CAPACITY;
+    long LOG_END;
+    HistoryStep *STEPS;
+    long STEP_CAPACITY;
+    long FIRST;
+    long CURRENT;
+    long LAST;
+    int VISIBLE_BEFORE;
+    State STATE_BEFORE;
+} History;
+
+void historyInit(History *history, long maxSteps, long maxChanges);
+void historyFree(History *history);
+void historyClear(History *history);
+void historyBegin(History *history, Status status, FloodWork *work);
+void historyCommit(History *history, TILE **board, Status status, FloodWork *work);
+bool historyUndo(History *history, TILE **board, Status *status);
+bool historyRedo(History *history, TILE **board, Status *status);
+size_t historyBytes(const History *history);
+
+#endif
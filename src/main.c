@@ -1,144 +1,132 @@
+// The app, on the desktop against raylib; the Android build compiles the
+// same sources with raylib's Android toolchain:
+//
+//     cc -O2 -Iinclude -Isrc src/main.c src/game.c src/topology.c src/frontier.c src/openings.c src/bitmap.c src/history.c src/save.c src/noguess.c src/solver.c src/probability.c src/hint.c -lraylib -pthread -lm -o minesweeper
+//
+// The 3D mode adds -DVOLUME_DEPTH=n src/volume.c src/volumeview.c. Keep
+// the list in step with the modules main.c reaches.
+
 #include <stdbool.h>
 #include "raylib.h"
+#include "game.h"
+#include "openings.h"
+#include "frontier.h"
+#include "history.h"
+#include "save.h"
+#include "noguess.h"
+#include "hint.h"
+#include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
+#ifdef VOLUME_DEPTH
+#include "volume.h"
+#include "volumeview.h"
+#endif
+#ifdef PLATFORM_ANDROID
+#include <android_native_app_glue.h>
 
-typedef enum State {
-    START,
-    PLAYING,
-    WIN,
-    LOSE
-} State;
-
-typedef enum CellMark {
-    CELL_CLEARED,
-    CELL_FLAGGED,
-    CELL_QUESTIONED
-} CellMark;
-
-typedef enum CellType {
-    BLANK_TILE,
-    NUMBER,
-    MINE,
-    MINE_EXPLOSION,
-    ANY
-} CellType;
-
-typedef struct TILE {
-    CellType TYPE;
-    int AMOUNT;
-    CellMark MARK;
-    bool VISIBLE;
-} TILE;
-
-typedef struct Status {
-    int WIDTH;
-    int HEIGHT;
-    int W_TILES;
-    int H_TILES;
-    int TILE;
-    int BOMBS;
-    int VISIBLE_TILES;
-    State STATE;
-    CellType FIRST_CELL;
-    unsigned int MAX_ITERATIONS;
-} Status;
-
-void initializeBoard(TILE **board, int width, int height) {
-    for (int i = 0; i < width; i++) {
-        for (int j = 0; j < height; j++) {
-            board[i][j].TYPE = BLANK_TILE;
-            board[i][j].AMOUNT = 0;
-            board[i][j].VISIBLE = false;
-            board[i][j].MARK = CELL_CLEARED;
-        }
-    }
-}
+struct android_app *GetAndroidApp(void);    // raylib's Android platform layer
+#endif
 
-void freeMem(Status status, TILE **board) {
-    for (int i = 0; i < status.W_TILES; i++) {
-        free(board[i]);
-    }
-    free(board);
-}
+#ifndef VOLUME_DEPTH
+#define SAVE_FILE "minesweeper.sav"
 
-void generateBombs(TILE **board, int count, Status status) {
-    int x, y;
+// On Android raylib's file functions read the APK's assets, so the snapshot
+// goes through stdio at an absolute path in the app's internal storage
+static char savePath[512] = SAVE_FILE;
 
-    for (int i = 0; i < count; i++) {
-        x = rand() % status.W_TILES;
-        y = rand() % status.H_TILES;
-        board[x][y].TYPE = MINE;
-    }
+static void saveSnapshot(TILE **board, Status status) {
+    saveGameFile(savePath, board, status);
 }
 
-void generateNumbers(TILE **board, Status *status) {
-    int directions[8][2] = {
-            {-1, -1}, {-1, 0}, {-1, 1},
-            { 0, -1},          { 0, 1},
-            { 1, -1}, { 1, 0}, { 1, 1}
-    };
-    status->BOMBS = 0;
-    for (int x = 0; x < status->W_TILES; x++) {
-        for (int y = 0; y < status->H_TILES; y++) {
-            if (board[x][y].TYPE != MINE) {
-                for (int d = 0; d < 8; d++) {
-                    int newX = x + directions[d][0];
-                    int newY = y + directions[d][1];
-
-                    if (newX >= 0 && newX < status->W_TILES && newY >= 0 && newY < status->H_TILES) {
-                        if (board[newX][newY].TYPE == MINE) {
-                            board[x][y].TYPE = NUMBER;
-                            board[x][y].AMOUNT += 1;
-                        }
-                    }
-                }
-            } else {
-                status->BOMBS += 1;
-            }
-        }
-    }
+static bool loadSnapshot(TILE **board, Status *status) {
+    return loadGameFile(savePath, board, status);
 }
 
-void revealEmptyCells(TILE **board, int x, int y, Status *status) {
-    int directions[8][2] = {
-            {-1, -1}, {-1, 0}, {-1, 1},
-            { 0, -1},          { 0, 1},
-            { 1, -1}, { 1, 0}, { 1, 1}
-    };
-
-    if (x < 0 || x >= status->W_TILES || y < 0 || y >= status->H_TILES || board[x][y].VISIBLE) {
-        return;
-    }
-
-    if (board[x][y].MARK == CELL_FLAGGED) {
-        return;
+#ifdef PLATFORM_ANDROID
+static TILE **savedBoard;
+static Status *savedStatus;
+static void (*raylibAppCommand)(struct android_app *app, int32_t command);
+
+// Once the activity loses focus raylib blocks inside its event polling, so
+// the game loop never sees the pause. The snapshot is written from the
+// activity's pause and stop commands instead, which arrive between frames.
+static void saveOnPause(struct android_app *app, int32_t command) {
+    if (command == APP_CMD_PAUSE || command == APP_CMD_STOP) {
+        saveSnapshot(savedBoard, *savedStatus);
     }
+    raylibAppCommand(app, command);
+}
+#endif
+#endif
 
-    board[x][y].VISIBLE = true;
-    status->VISIBLE_TILES += 1;
+#ifdef VOLUME_DEPTH
+// Built with -DVOLUME_DEPTH=n the game is a W_TILES x H_TILES x n volume
+// shown one layer at a time: A or a double tap opens the cursor's cell on
+// the layer, B flags it, R deals a new board and swipes step through the
+// layers. Large openings spread over several frames.
+static void playVolume(Status status, const Texture *sprites, Texture cursor, const Texture *buttons,
+                       const Rectangle *limits) {
+    Volume volume;
+    volumeInit(&volume, status.W_TILES, status.H_TILES, VOLUME_DEPTH);
+    volumeClear(&volume);
+    int bombs = status.W_TILES * status.H_TILES * VOLUME_DEPTH / 12;
+    Rng rng = {(uint64_t) time(NULL)};
+    int layer = VOLUME_DEPTH / 2;
+    char label[32];
 
-    if (board[x][y].TYPE == MINE) {
-        board[x][y].TYPE = MINE_EXPLOSION;
-        status->STATE = LOSE;
-        return;
-    }
+    Vector2 cursorRect = {0, 0};
+    Vector2 touchPosition = {0, 0};
+    Vector2 lastTouchPosition = {0, 0};
+    Rectangle touchLimit = {0, 0, status.TILE * status.W_TILES, status.TILE * status.H_TILES};
 
-    if ((status->VISIBLE_TILES + status->BOMBS) == (status->W_TILES * status->H_TILES)) {
-        status->STATE = WIN;
-    }
+    while (!WindowShouldClose()) {
+        lastTouchPosition = touchPosition;
+        touchPosition = GetTouchPosition(0);
+        bool moved = lastTouchPosition.x != touchPosition.x || lastTouchPosition.y != touchPosition.y;
 
-    if (board[x][y].TYPE == NUMBER) {
-        return;
-    }
+        if (CheckCollisionPointRec(touchPosition, touchLimit) && moved) {
+            cursorRect.x = touchPosition.x - ( (int) touchPosition.x % status.TILE);
+            cursorRect.y = touchPosition.y - ( (int) touchPosition.y % status.TILE);
+        }
+        int rectX = cursorRect.x / status.TILE;
+        int rectY = cursorRect.y / status.TILE;
 
+        if (CheckCollisionPointRec(touchPosition, limits[2]) && moved) {
+            volumeClear(&volume);
+        }
+        if ((CheckCollisionPointRec(touchPosition, limits[0]) && moved)
+            || (CheckCollisionPointRec(touchPosition, touchLimit) && IsGestureDetected(GESTURE_DOUBLETAP))) {
+            if (volume.STATE == START) {
+                volumeGenerate(&volume, bombs, rectX, rectY, layer, &rng);
+            }
+            volumeReveal(&volume, rectX, rectY, layer);
+        }
+        if (CheckCollisionPointRec(touchPosition, limits[1]) && moved) {
+            volumeFlag(&volume, rectX, rectY, layer);
+        }
+        if (IsGestureDetected(GESTURE_SWIPE_LEFT) && layer > 0) {
+            layer--;
+        }
+        if (IsGestureDetected(GESTURE_SWIPE_RIGHT) && layer < VOLUME_DEPTH - 1) {
+            layer++;
+        }
+        volumeSpread(&volume, VOLUME_FRAME_BUDGET);
 
-    for (int d = 0; d < 8; d++) {
-        int newX = x + directions[d][0];
-        int newY = y + directions[d][1];
-        revealEmptyCells(board, newX, newY, status);
+        BeginDrawing();
+        ClearBackground(RAYWHITE);
+        drawVolumeLayer(&volume, layer, 0, 0, status.W_TILES, status.H_TILES, (Vector2) {0, 0}, status.TILE, sprites);
+        DrawTextureV(cursor, cursorRect, WHITE);
+        for (int i = 0; i < 3; i++) {
+            DrawTextureV(buttons[i], (Vector2) {limits[i].x, limits[i].y}, WHITE);
+        }
+        snprintf(label, sizeof(label), "%d / %d", layer + 1, VOLUME_DEPTH);
+        DrawText(label, 20, status.TILE * status.H_TILES + 20, status.TILE / 2, DARKGRAY);
+        EndDrawing();
     }
+    volumeFree(&volume);
 }
+#endif
 
 int main( int argc, char *argv[] )
 {
@@ -154,31 +142,16 @@ int main( int argc, char *argv[] )
             .STATE = START,
             .VISIBLE_TILES = 0,
             .FIRST_CELL = BLANK_TILE,
-            .MAX_ITERATIONS = 10000
+            .NO_GUESS = true
     };
     status.WIDTH = 1080;
     status.HEIGHT = 2292;
 
-    unsigned int iterationCounter = 0;
-
-    Status defaultStatus = status;
-
-    TILE **board = malloc(status.W_TILES * sizeof(TILE *));
-    for (int i = 0; i < status.W_TILES; i++) {
-        board[i] = malloc(status.H_TILES * sizeof(TILE));
-    }
-
-    initializeBoard(board, status.W_TILES, status.H_TILES);
 
     InitWindow(status.WIDTH, status.HEIGHT, "Minesweeper");
 
-
     SetTargetFPS(60);
 
-    // GENERATE BOMBS And NUMBERS
-    generateBombs(board, status.BOMBS, status);
-    generateNumbers(board, &status);
-
 #ifndef PLATFORM_ANDROID
     ChangeDirectory("assets");
 #endif
@@ -208,7 +181,6 @@ int main( int argc, char *argv[] )
     ImageResize(&cursorImg, status.TILE, status.TILE);
     Texture cursor = LoadTextureFromImage(cursorImg);
     UnloadImage(cursorImg);
-    Vector2 cursorRect = {0, 0};
 
     // SPRITE ARRAY
     Texture sprites[16];
@@ -227,6 +199,50 @@ int main( int argc, char *argv[] )
     UnloadImage(atlas);
 
 
+#ifdef VOLUME_DEPTH
+    // The volume takes the place of the 2D game, whose board is never
+    // dealt, loaded or saved; the volume itself is not saved either
+    playVolume(status, sprites, cursor, (Texture[]) {aBtn, bBtn, rBtn},
+               (Rectangle[]) {aBtnLimit, bBtnLimit, rBtnLimit});
+#else
+    Status defaultStatus = status;
+
+    TILE **board = allocBoard(status.W_TILES, status.H_TILES);
+
+    initializeBoard(board, status.W_TILES, status.H_TILES);
+
+#ifdef PLATFORM_ANDROID
+    struct android_app *app = GetAndroidApp();
+    snprintf(savePath, sizeof(savePath), "%s/%s", app->activity->internalDataPath, SAVE_FILE);
+    savedBoard = board;
+    savedStatus = &status;
+    raylibAppCommand = app->onAppCmd;
+    app->onAppCmd = saveOnPause;
+#endif
+
+
+    // GENERATE BOMBS And NUMBERS
+    generateBombs(board, status.BOMBS, status);
+    generateNumbers(board, &status);
+    loadSnapshot(board, &status);
+    OpeningMap openings = {0};
+    buildOpeningMap(board, status, &openings);
+    Frontier frontier;
+    frontierInit(&frontier, status);
+    frontierBuild(&frontier, board, status);
+    FloodWork floodWork = {0};
+    floodWork.FRONTIER = &frontier;
+    History history;
+    historyInit(&history, 1024, 1 << 16);
+    NoGuess noGuess;
+    noGuessInit(&noGuess, status);
+    Rng rng = {(uint64_t) t};
+    Hint hint;
+    hintInit(&hint, status);
+    unsigned int generation = 0;    // bumped by every move, so stale hints are dropped
+    bool showHint = false;
+    Vector2 cursorRect = {0, 0};
+
     // GENERAL VAR SETTINGS
     bool setVisibleTiles = false;
 
@@ -235,9 +251,20 @@ int main( int argc, char *argv[] )
     Vector2 touchPosition = {0, 0};
     Vector2 lastTouchPosition = {0, 0};
     Rectangle touchLimit = {0, 0, status.TILE * status.W_TILES, status.TILE * status.H_TILES};
+#ifndef PLATFORM_ANDROID
+    bool focused = true;
+#endif
 
     while (!WindowShouldClose()) {
 
+#ifndef PLATFORM_ANDROID
+        // SAVE WHEN THE WINDOW LOSES FOCUS
+        if (focused && !IsWindowFocused()) {
+            saveSnapshot(board, status);
+        }
+        focused = IsWindowFocused();
+#endif
+
         lastTouchPosition = touchPosition;
         touchPosition = GetTouchPosition(0);
 
@@ -260,6 +287,11 @@ int main( int argc, char *argv[] )
             initializeBoard(board, status.W_TILES, status.H_TILES);
             generateBombs(board, status.BOMBS, status);
             generateNumbers(board, &status);
+            buildOpeningMap(board, status, &openings);
+            frontierBuild(&frontier, board, status);
+            hintInvalidate(&hint);
+            historyClear(&history);
+            generation++;
         }
 
         if (IsGestureDetected(GESTURE_PINCH_OUT)) {
@@ -267,40 +299,87 @@ int main( int argc, char *argv[] )
         }
 
         if ((CheckCollisionPointRec(touchPosition, aBtnLimit) && (lastTouchPosition.x != touchPosition.x || lastTouchPosition.y != touchPosition.y)) || (CheckCollisionPointRec(touchPosition, touchLimit) && (IsGestureDetected(GESTURE_DOUBLETAP)))) {
-            iterationCounter = 0;
-            if (status.STATE == START && status.FIRST_CELL != ANY) {
-                while (board[rectX][rectY].TYPE != status.FIRST_CELL) {
+            if (status.STATE == START && status.NO_GUESS) {
+                status.BOMBS = defaultStatus.BOMBS;
+                bool solvable = generateNoGuess(board, &status, rectX, rectY, &rng, &noGuess);
+                if (!solvable) {
+                    // Deal a plain board and leave the game in START, so the
+                    // first click is still settled below
                     status.BOMBS = defaultStatus.BOMBS;
                     status.VISIBLE_TILES = defaultStatus.VISIBLE_TILES;
                     initializeBoard(board, status.W_TILES, status.H_TILES);
                     generateBombs(board, status.BOMBS, status);
                     generateNumbers(board, &status);
-
-                    iterationCounter++;
-                    if (iterationCounter > status.MAX_ITERATIONS) {
-                        CloseWindow();
-                        break;
-                    }
-
                 }
+                buildOpeningMap(board, status, &openings);
+                frontierBuild(&frontier, board, status);
+                hintInvalidate(&hint);
+                historyClear(&history);
+                if (solvable) {
+                    status.STATE = PLAYING;
+                }
+            }
+            if (status.STATE == START && status.FIRST_CELL != ANY) {
+                if (!settleFirstCell(board, rectX, rectY, status, status.FIRST_CELL) && board[rectX][rectY].TYPE == MINE) {
+                    // Too full for the wanted cell; at least do not lose on the first click
+                    settleFirstCell(board, rectX, rectY, status, NUMBER);
+                }
+                buildOpeningMap(board, status, &openings);
+                frontierBuild(&frontier, board, status);
+                hintInvalidate(&hint);
+                historyClear(&history);
                 status.STATE = PLAYING;
             }
-            if (board[rectX][rectY].MARK != CELL_FLAGGED && (status.STATE == START || status.STATE == PLAYING)) {
-                revealEmptyCells(board, rectX, rectY, &status);
+            generation++;
+            historyBegin(&history, status, &floodWork);
+            if (board[rectX][rectY].VISIBLE && status.STATE == PLAYING) {
+                chordCell(board, rectX, rectY, &status, &floodWork);
+            } else if (board[rectX][rectY].MARK != CELL_FLAGGED && (status.STATE == START || status.STATE == PLAYING)) {
+                revealOpening(board, &openings, rectX, rectY, &status, &floodWork, NULL);
             }
+            historyCommit(&history, board, status, &floodWork);
+            hintTrack(&hint, &floodWork);
         }
 
         if (CheckCollisionPointRec(touchPosition, bBtnLimit) && (lastTouchPosition.x != touchPosition.x || lastTouchPosition.y != touchPosition.y)) {
-            if (status.STATE == PLAYING && (!board[rectX][rectY].VISIBLE || (setVisibleTiles && !board[rectX][rectY].VISIBLE))) {
-                board[rectX][rectY].MARK = (board[rectX][rectY].MARK + 1) % 3;
-            } else {
-                board[rectX][rectY].MARK = CELL_CLEARED;
+            generation++;
+            historyBegin(&history, status, &floodWork);
+            markCell(board, rectX, rectY, status, &floodWork);
+            historyCommit(&history, board, status, &floodWork);
+            hintTrack(&hint, &floodWork);
+        }
+
+        if (IsGestureDetected(GESTURE_SWIPE_LEFT)) {
+            if (historyUndo(&history, board, &status)) {
+                frontierBuild(&frontier, board, status);
+                hintInvalidate(&hint);
+                generation++;
+            }
+        }
+
+        if (IsGestureDetected(GESTURE_SWIPE_RIGHT)) {
+            if (historyRedo(&history, board, &status)) {
+                frontierBuild(&frontier, board, status);
+                hintInvalidate(&hint);
+                generation++;
             }
         }
 
 
 
 
+        // HINT ON LONG PRESS: big boards answer on a later frame
+        if (IsGestureDetected(GESTURE_HOLD) && CheckCollisionPointRec(touchPosition, touchLimit) && status.STATE == PLAYING
+            && !(showHint && hint.GENERATION == generation)) {
+            hintRequest(&hint, board, status, &frontier, generation);
+        }
+        if (hintPoll(&hint)) {
+            showHint = hint.GENERATION == generation && hint.CELL >= 0;
+            TraceLog(LOG_INFO, "HINT: %s cell in %.3f ms (worst %.3f ms)", hint.SAFE ? "safe" : "guess",
+                     hint.SECONDS * 1000, hint.WORST_SECONDS * 1000);
+        }
+        showHint = showHint && hint.GENERATION == generation;
+
         BeginDrawing();
 
         ClearBackground(RAYWHITE);
@@ -351,6 +430,12 @@ int main( int argc, char *argv[] )
             }
         }
 
+        if (showHint) {
+            Rectangle hintRect = {hint.CELL / status.H_TILES * status.TILE, hint.CELL % status.H_TILES * status.TILE,
+                                  status.TILE, status.TILE};
+            DrawRectangleLinesEx(hintRect, 8, hint.SAFE ? GREEN : ORANGE);
+        }
+
         // RENDER CURSOR
         DrawTextureV(cursor, cursorRect, WHITE);
 
@@ -362,6 +447,9 @@ int main( int argc, char *argv[] )
 
     }
 
+    saveSnapshot(board, status);
+#endif
+
     UnloadTexture(aBtn);
     UnloadTexture(bBtn);
     UnloadTexture(cursor);
@@ -372,7 +460,15 @@ int main( int argc, char *argv[] )
 
     CloseWindow();          // Close window and OpenGL context
 
+#ifndef VOLUME_DEPTH
     freeMem(status, board);
+    freeOpeningMap(&openings);
+    freeFloodWork(&floodWork);
+    frontierFree(&frontier);
+    historyFree(&history);
+    noGuessFree(&noGuess);
+    hintFree(&hint);
+#endif
 
 
     return 0;
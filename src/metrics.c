@@ -0,0 +1,145 @@
+#include "metrics.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define CELL_MINE 1
+#define CELL_NUMBER 2
+#define CELL_BORDER 4
+#define OPENED 8
+#define FLAGGED 16
+#define GROUPED 32          // isolated number already counted in an island
+
+void freeMetricsWork(MetricsWork *work) {
+    free(work->STATE);
+    free(work->STACK);
+    *work = (MetricsWork) {0};
+}
+
+// Flood from p through cells whose kind bits equal kind and that carry none
+// of the skip bits, setting bit on each. With spill, the non-mine cells
+// bordering the region get bit as well without being entered.
+static void flood(MetricsWork *work, const int offsets[8], int p, unsigned char kind, unsigned char bit,
+                  unsigned char skip, bool spill) {
+    unsigned char *state = work->STATE;
+    int top = 0;
+    state[p] |= bit;
+    work->STACK[top++] = p;
+    while (top > 0) {
+        int q = work->STACK[--top];
+        for (int d = 0; d < 8; d++) {
+            int n = q + offsets[d];
+            unsigned char cell = state[n];
+            if (cell & (bit | skip | CELL_BORDER)) {
+                continue;
+            }
+            if ((cell & (CELL_MINE | CELL_NUMBER)) == kind) {
+                state[n] = cell | bit;
+                work->STACK[top++] = n;
+            } else if (spill && !(cell & CELL_MINE)) {
+                state[n] = cell | bit;
+            }
+        }
+    }
+}
+
+// Flag the hidden mines around a number and chord it when that costs fewer
+// clicks than opening its closed neighbours one at a time. Returns the
+// clicks spent, 0 when chording does not pay.
+static int chordIfCheaper(unsigned char *state, const int offsets[8], int p) {
+    int closed = 0, flags = 0;
+    for (int d = 0; d < 8; d++) {
+        unsigned char cell = state[p + offsets[d]];
+        if (cell & CELL_BORDER) {
+            continue;
+        }
+        if (cell & CELL_MINE) {
+            flags += !(cell & FLAGGED);
+        } else {
+            closed += !(cell & OPENED);
+        }
+    }
+    if (closed <= flags + 1) {
+        return 0;
+    }
+
+    int clicks = !(state[p] & OPENED) + flags + 1;
+    state[p] |= OPENED;
+    for (int d = 0; d < 8; d++) {
+        unsigned char *cell = &state[p + offsets[d]];
+        *cell |= *cell & CELL_MINE ? FLAGGED : OPENED;
+    }
+    return clicks;
+}
+
+// One pass copies the board into the bordered byte grid, then three more
+// each visit a cell and its neighbours a bounded number of times. The first
+// opens every opening with one click. The second counts the numbers left
+// closed and groups them into islands. The third walks the numbers in index
+// order, chording wherever that pays, then clicks each number still closed.
+// This is a greedy ZiNi: it is a real click sequence, so it never undercuts
+// the true minimum, and it never exceeds 3BV.
+void computeMetrics(TILE **board, Status status, MetricsWork *work, BoardMetrics *metrics) {
+    int w = status.W_TILES, h = status.H_TILES, stride = h + 2;
+    if (work->W_TILES != w || work->H_TILES != h) {
+        freeMetricsWork(work);
+        work->W_TILES = w;
+        work->H_TILES = h;
+        work->STATE = malloc((w + 2) * stride);
+        work->STACK = malloc(w * h * sizeof(int));
+    }
+    unsigned char *state = work->STATE;
+    const int offsets[8] = {-stride - 1, -stride, -stride + 1, -1, 1, stride - 1, stride, stride + 1};
+    *metrics = (BoardMetrics) {0};
+
+    memset(state, CELL_BORDER, stride);
+    memset(state + (w + 1) * stride, CELL_BORDER, stride);
+    for (int x = 0; x < w; x++) {
+        unsigned char *column = state + (x + 1) * stride;
+        column[0] = column[h + 1] = CELL_BORDER;
+        for (int y = 0; y < h; y++) {
+            CellType type = board[x][y].TYPE;
+            column[y + 1] = type == MINE || type == MINE_EXPLOSION ? CELL_MINE : type == NUMBER ? CELL_NUMBER : 0;
+        }
+    }
+
+    // OPENINGS
+    for (int x = 1; x <= w; x++) {
+        for (int p = x * stride + 1; p <= x * stride + h; p++) {
+            if (state[p] == 0) {
+                metrics->OPENINGS += 1;
+                flood(work, offsets, p, 0, OPENED, 0, true);
+            }
+        }
+    }
+
+    // ISOLATED NUMBERS AND THEIR ISLANDS
+    for (int x = 1; x <= w; x++) {
+        for (int p = x * stride + 1; p <= x * stride + h; p++) {
+            if ((state[p] & (CELL_NUMBER | OPENED)) != CELL_NUMBER) {
+                continue;
+            }
+            metrics->ISOLATED += 1;
+            if (!(state[p] & GROUPED)) {
+                metrics->ISLANDS += 1;
+                flood(work, offsets, p, CELL_NUMBER, GROUPED, OPENED, false);
+            }
+        }
+    }
+    metrics->BBBV = metrics->OPENINGS + metrics->ISOLATED;
+
+    // GREEDY CHORDS, THEN SINGLE CLICKS
+    int clicks = metrics->OPENINGS;
+    for (int x = 1; x <= w; x++) {
+        for (int p = x * stride + 1; p <= x * stride + h; p++) {
+            if (state[p] & CELL_NUMBER) {
+                clicks += chordIfCheaper(state, offsets, p);
+            }
+        }
+    }
+    for (int x = 1; x <= w; x++) {
+        for (int p = x * stride + 1; p <= x * stride + h; p++) {
+            clicks += (state[p] & (CELL_NUMBER | OPENED)) == CELL_NUMBER;
+        }
+    }
+    metrics->ZINI = clicks;
+}
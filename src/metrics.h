@@ -0,0 +1,28 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include "game.h"
+
+// Standard difficulty measures of a generated board
+typedef struct BoardMetrics {
+    int BBBV;           // openings plus isolated numbers: clicks without flags or chords
+    int OPENINGS;       // 8-connected zero regions
+    int ISOLATED;       // numbers no opening uncovers
+    int ISLANDS;        // 8-connected groups of isolated numbers
+    int ZINI;           // clicks of a greedy flag and chord solution, at most BBBV
+} BoardMetrics;
+
+// Scratch for computeMetrics, sized to the board on first use: a copy of
+// the board as one byte per cell with a one cell border, column by column,
+// so no pass needs bounds checks or touches a TILE again.
+typedef struct MetricsWork {
+    int W_TILES;
+    int H_TILES;
+    unsigned char *STATE;
+    int *STACK;
+} MetricsWork;
+
+void computeMetrics(TILE **board, Status status, MetricsWork *work, BoardMetrics *metrics);
+void freeMetricsWork(MetricsWork *work);
+
+#endif
@@ -0,0 +1,271 @@
+#include "noguess.h"
+#include <limits.h>
+#include <pthread.h>
+#include <stdlib.h>
+
+void noGuessInit(NoGuess *noGuess, Status status) {
+    int cells = status.W_TILES * status.H_TILES;
+    solverInit(&noGuess->SOLVER, status);
+    noGuess->WORK = (FloodWork) {0};
+    noGuess->CELLS = malloc(cells * sizeof(int));
+    noGuess->FROM = malloc(cells * sizeof(int));
+    noGuess->TO = malloc(cells * sizeof(int));
+    noGuess->MAX_CANDIDATES = 1000;
+    noGuess->MAX_REPAIRS = cells;
+    noGuess->CANDIDATES = 0;
+    noGuess->REPAIRS = 0;
+    noGuess->WINNER = NULL;
+    noGuess->INDEX = 0;
+}
+
+void noGuessFree(NoGuess *noGuess) {
+    solverFree(&noGuess->SOLVER);
+    freeFloodWork(&noGuess->WORK);
+    free(noGuess->CELLS);
+    free(noGuess->FROM);
+    free(noGuess->TO);
+}
+
+static bool nearCell(int x, int y, int cx, int cy) {
+    return abs(x - cx) <= 1 && abs(y - cy) <= 1;
+}
+
+// Exactly status->BOMBS distinct mines, none around the first click so it
+// always opens. cells is scratch for W_TILES * H_TILES ints.
+bool placeMines(TILE **board, Status *status, int x, int y, Rng *rng, int *cells) {
+    int count = 0;
+    for (int i = 0; i < status->W_TILES; i++) {
+        for (int j = 0; j < status->H_TILES; j++) {
+            if (!nearCell(i, j, x, y)) {
+                cells[count++] = i * status->H_TILES + j;
+            }
+        }
+    }
+    if (status->BOMBS > count) {
+        return false;
+    }
+
+    initializeBoard(board, status->W_TILES, status->H_TILES);
+    for (int i = 0; i < status->BOMBS; i++) {
+        int pick = i + rngRange(rng, count - i);
+        int cell = cells[pick];
+        cells[pick] = cells[i];
+        cells[i] = cell;
+        board[cell / status->H_TILES][cell % status->H_TILES].TYPE = MINE;
+    }
+    generateNumbers(board, status);
+    return true;
+}
+
+static void revealSafe(TILE **board, Status *status, Solver *solver, FloodWork *work) {
+    work->CHANGE_COUNT = 0;
+    for (int i = 0; i < solver->SAFE_COUNT; i++) {
+        int cell = solver->SAFE[i];
+        revealEmptyCells(board, cell / status->H_TILES, cell % status->H_TILES, status, work);
+    }
+    solver->SAFE_COUNT = 0;
+    solverUpdate(solver, board, *status, work);
+}
+
+// Move one undecidable frontier mine into the untouched interior. Every
+// earlier deduction stays true: only unknown cells change, and the revealed
+// numbers around the old spot are requeued.
+static bool repair(TILE **board, Status *status, Rng *rng, NoGuess *noGuess) {
+    Solver *solver = &noGuess->SOLVER;
+    int h = status->H_TILES;
+    int from = 0, to = 0;
+
+    for (int x = 0; x < status->W_TILES; x++) {
+        for (int y = 0; y < h; y++) {
+            if (board[x][y].VISIBLE || solver->KNOWN[x * h + y] != KNOWN_NOTHING) {
+                continue;
+            }
+            bool frontier = false;
+            for (int nx = x - 1; nx <= x + 1 && !frontier; nx++) {
+                for (int ny = y - 1; ny <= y + 1; ny++) {
+                    if (nx >= 0 && nx < status->W_TILES && ny >= 0 && ny < h && board[nx][ny].VISIBLE) {
+                        frontier = true;
+                        break;
+                    }
+                }
+            }
+            if (frontier && board[x][y].TYPE == MINE) {
+                noGuess->FROM[from++] = x * h + y;
+            } else if (!frontier && board[x][y].TYPE != MINE) {
+                noGuess->TO[to++] = x * h + y;
+            }
+        }
+    }
+    if (from == 0 || to == 0) {
+        return false;
+    }
+
+    int source = noGuess->FROM[rngRange(rng, from)];
+    int target = noGuess->TO[rngRange(rng, to)];
+    int sx = source / h, sy = source % h;
+    removeMine(board, sx, sy, *status);
+    addMine(board, target / h, target % h, *status);
+
+    noGuess->WORK.CHANGE_COUNT = 0;
+    for (int nx = sx - 1; nx <= sx + 1; nx++) {
+        for (int ny = sy - 1; ny <= sy + 1; ny++) {
+            if (nx < 0 || nx >= status->W_TILES || ny < 0 || ny >= h || !board[nx][ny].VISIBLE) {
+                continue;
+            }
+            // A revealed number that dropped to zero opens its neighbours
+            if (board[nx][ny].TYPE == BLANK_TILE) {
+                for (int d = 0; d < 9; d++) {
+                    int ox = nx + d / 3 - 1, oy = ny + d % 3 - 1;
+                    if (ox >= 0 && ox < status->W_TILES && oy >= 0 && oy < h) {
+                        revealEmptyCells(board, ox, oy, status, &noGuess->WORK);
+                    }
+                }
+            }
+        }
+    }
+    solverUpdate(solver, board, *status, &noGuess->WORK);
+    solverTouch(solver, board, sx, sy);
+    return true;
+}
+
+bool generateNoGuess(TILE **board, Status *status, int x, int y, Rng *rng, NoGuess *noGuess) {
+    Solver *solver = &noGuess->SOLVER;
+    FloodWork *work = &noGuess->WORK;
+    int bombs = status->BOMBS;
+    noGuess->CANDIDATES = 0;
+    noGuess->REPAIRS = 0;
+
+    while (noGuess->CANDIDATES < noGuess->MAX_CANDIDATES) {
+        noGuess->CANDIDATES += 1;
+        status->BOMBS = bombs;
+        if (!placeMines(board, status, x, y, rng, noGuess->CELLS)) {
+            return false;
+        }
+
+        status->VISIBLE_TILES = 0;
+        status->STATE = PLAYING;
+        solverReset(solver);
+        work->RECORD = true;
+        work->CHANGE_COUNT = 0;
+        revealEmptyCells(board, x, y, status, work);
+        solverUpdate(solver, board, *status, work);
+
+        int repairs = 0;
+        while (status->STATE == PLAYING) {
+            if (noGuess->WINNER != NULL && atomic_load_explicit(noGuess->WINNER, memory_order_relaxed) < noGuess->INDEX) {
+                break;
+            }
+            solverRun(solver, board, *status);
+            if (solver->SAFE_COUNT > 0) {
+                revealSafe(board, status, solver, work);
+            } else if (repairs == noGuess->MAX_REPAIRS || !repair(board, status, rng, noGuess)) {
+                break;
+            } else {
+                repairs += 1;
+            }
+        }
+        noGuess->REPAIRS += repairs;
+        work->RECORD = false;
+
+        if (status->STATE == WIN) {
+            for (int i = 0; i < status->W_TILES; i++) {
+                for (int j = 0; j < status->H_TILES; j++) {
+                    board[i][j].VISIBLE = false;
+                }
+            }
+            status->VISIBLE_TILES = 0;
+            status->STATE = START;
+            return true;
+        }
+    }
+    return false;
+}
+
+typedef struct NoGuessWorker {
+    pthread_t THREAD;
+    int ID;
+    int THREADS;
+    int MAX_CANDIDATES;
+    int X;
+    int Y;
+    uint64_t SEED;
+    TILE **BOARD;
+    Status STATUS;
+    NoGuess NOGUESS;
+    atomic_int *WINNER;
+} NoGuessWorker;
+
+// Candidate k is drawn from stream k of the seed and handled by worker
+// k % THREADS. The lowest successful k wins, so the board only depends on
+// the seed; workers stop as soon as every candidate they still own is
+// above the current winner.
+static void *noGuessWorker(void *arg) {
+    NoGuessWorker *worker = arg;
+    NoGuess *noGuess = &worker->NOGUESS;
+    noGuess->MAX_CANDIDATES = 1;
+    noGuess->WINNER = worker->WINNER;
+
+    for (int k = worker->ID; k < worker->MAX_CANDIDATES; k += worker->THREADS) {
+        if (atomic_load_explicit(worker->WINNER, memory_order_relaxed) < k) {
+            break;
+        }
+        Rng rng = rngStream(worker->SEED, k);
+        Status status = worker->STATUS;
+        noGuess->INDEX = k;
+        if (generateNoGuess(worker->BOARD, &status, worker->X, worker->Y, &rng, noGuess)) {
+            int best = atomic_load(worker->WINNER);
+            while (k < best && !atomic_compare_exchange_weak(worker->WINNER, &best, k)) {}
+            break;
+        }
+    }
+    return NULL;
+}
+
+int generateNoGuessParallel(TILE **board, Status *status, int x, int y, uint64_t seed, int threads, int maxCandidates) {
+    atomic_int winner = INT_MAX;
+    NoGuessWorker *workers = malloc(threads * sizeof(NoGuessWorker));
+
+    for (int i = 0; i < threads; i++) {
+        NoGuessWorker *worker = &workers[i];
+        worker->ID = i;
+        worker->THREADS = threads;
+        worker->MAX_CANDIDATES = maxCandidates;
+        worker->X = x;
+        worker->Y = y;
+        worker->SEED = seed;
+        worker->STATUS = *status;
+        worker->BOARD = allocBoard(status->W_TILES, status->H_TILES);
+        worker->WINNER = &winner;
+        noGuessInit(&worker->NOGUESS, *status);
+    }
+    for (int i = 1; i < threads; i++) {
+        pthread_create(&workers[i].THREAD, NULL, noGuessWorker, &workers[i]);
+    }
+    noGuessWorker(&workers[0]);
+    for (int i = 1; i < threads; i++) {
+        pthread_join(workers[i].THREAD, NULL);
+    }
+
+    int result = atomic_load(&winner);
+    if (result == INT_MAX) {
+        result = -1;
+    } else {
+        // The winner's board was left untouched once it succeeded
+        NoGuessWorker *worker = &workers[result % threads];
+        for (int i = 0; i < status->W_TILES; i++) {
+            for (int j = 0; j < status->H_TILES; j++) {
+                board[i][j] = worker->BOARD[i][j];
+            }
+        }
+        status->BOMBS = worker->STATUS.BOMBS;
+        status->VISIBLE_TILES = 0;
+        status->STATE = START;
+    }
+
+    for (int i = 0; i < threads; i++) {
+        noGuessFree(&workers[i].NOGUESS);
+        freeMem(workers[i].STATUS, workers[i].BOARD);
+    }
+    free(workers);
+    return result;
+}
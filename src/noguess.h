@@ -0,0 +1,30 @@
+#ifndef NOGUESS_H
+#define NOGUESS_H
+
+#include <stdatomic.h>
+#include "game.h"
+#include "rng.h"
+#include "solver.h"
+
+// Scratch reused across boards plus counters for the last generateNoGuess call
+typedef struct NoGuess {
+    Solver SOLVER;
+    FloodWork WORK;
+    int *CELLS;
+    int *FROM;
+    int *TO;
+    int MAX_CANDIDATES;
+    int MAX_REPAIRS;
+    int CANDIDATES;
+    int REPAIRS;
+    const atomic_int *WINNER;   // parallel search: give up once a lower INDEX has won
+    int INDEX;
+} NoGuess;
+
+bool placeMines(TILE **board, Status *status, int x, int y, Rng *rng, int *cells);
+void noGuessInit(NoGuess *noGuess, Status status);
+void noGuessFree(NoGuess *noGuess);
+bool generateNoGuess(TILE **board, Status *status, int x, int y, Rng *rng, NoGuess *noGuess);
+int generateNoGuessParallel(TILE **board, Status *status, int x, int y, uint64_t seed, int threads, int maxCandidates);
+
+#endif
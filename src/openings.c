@@ -0,0 +1,208 @@
+#include "openings.h"
+#include "frontier.h"
+#include <stdlib.h>
+
+static int findRoot(int *parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+static void unite(int *parent, int a, int b) {
+    a = findRoot(parent, a);
+    b = findRoot(parent, b);
+    if (a < b) {
+        parent[b] = a;
+    } else if (b < a) {
+        parent[a] = b;
+    }
+}
+
+// Distinct opening ids around a number cell; a number touches at most four.
+static int touchingOpenings(const OpeningMap *map, int x, int y, int ids[8]) {
+    int count = 0;
+    for (int dx = -1; dx <= 1; dx++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            int nx = x + dx, ny = y + dy;
+            if ((dx == 0 && dy == 0) || nx < 0 || nx >= map->W_TILES || ny < 0 || ny >= map->H_TILES) {
+                continue;
+            }
+            int id = map->REGION[nx * map->H_TILES + ny];
+            if (id < 0) {
+                continue;
+            }
+            bool seen = false;
+            for (int i = 0; i < count; i++) {
+                if (ids[i] == id) seen = true;
+            }
+            if (!seen) {
+                ids[count++] = id;
+            }
+        }
+    }
+    return count;
+}
+
+void buildOpeningMap(TILE **board, Status status, OpeningMap *map) {
+    int w = status.W_TILES, h = status.H_TILES;
+    if (map->REGION == NULL || map->W_TILES * map->H_TILES != w * h) {
+        freeOpeningMap(map);
+        map->REGION = malloc(w * h * sizeof(int));
+        map->PARENT = malloc(w * h * sizeof(int));
+        map->START = malloc((w * h + 1) * sizeof(int));
+    }
+    map->W_TILES = w;
+    map->H_TILES = h;
+
+    // UNION BLANKS WITH THE BLANK NEIGHBOURS ALREADY SCANNED
+    int *parent = map->PARENT;
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) {
+            int i = x * h + y;
+            parent[i] = i;
+            if (board[x][y].TYPE != BLANK_TILE) {
+                continue;
+            }
+            if (y > 0 && board[x][y - 1].TYPE == BLANK_TILE) unite(parent, i, i - 1);
+            if (x > 0) {
+                for (int ny = y - 1; ny <= y + 1; ny++) {
+                    if (ny >= 0 && ny < h && board[x - 1][ny].TYPE == BLANK_TILE) unite(parent, i, i - h + (ny - y));
+                }
+            }
+        }
+    }
+
+    // LABEL ROOTS IN SCAN ORDER
+    map->COUNT = 0;
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) {
+            int i = x * h + y;
+            if (board[x][y].TYPE != BLANK_TILE) {
+                map->REGION[i] = -1;
+            } else if (findRoot(parent, i) == i) {
+                map->REGION[i] = map->COUNT++;
+            } else {
+                map->REGION[i] = map->REGION[findRoot(parent, i)];
+            }
+        }
+    }
+
+    // COUNT MEMBERS PER OPENING, REUSING PARENT AS THE PER-OPENING CURSOR
+    int *cursor = parent;
+    int ids[8];
+    int isolated = 0;
+    for (int r = 0; r <= map->COUNT; r++) {
+        map->START[r] = 0;
+    }
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) {
+            int region = map->REGION[x * h + y];
+            if (region >= 0) {
+                map->START[region + 1] += 1;
+            } else if (board[x][y].TYPE == NUMBER) {
+                int n = touchingOpenings(map, x, y, ids);
+                for (int k = 0; k < n; k++) {
+                    map->START[ids[k] + 1] += 1;
+                }
+                if (n == 0) {
+                    isolated += 1;
+                }
+            }
+        }
+    }
+    for (int r = 0; r < map->COUNT; r++) {
+        map->START[r + 1] += map->START[r];
+        cursor[r] = map->START[r];
+    }
+    map->BBBV = map->COUNT + isolated;
+
+    int members = map->START[map->COUNT];
+    if (members > map->CAPACITY) {
+        free(map->CELLS);
+        map->CELLS = malloc(members * sizeof(int));
+        map->CAPACITY = members;
+    }
+
+    // FILL IN INDEX ORDER SO EACH OPENING IS A SORTED SWEEP
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) {
+            int i = x * h + y;
+            int region = map->REGION[i];
+            if (region >= 0) {
+                map->CELLS[cursor[region]++] = i;
+            } else if (board[x][y].TYPE == NUMBER) {
+                int n = touchingOpenings(map, x, y, ids);
+                for (int k = 0; k < n; k++) {
+                    map->CELLS[cursor[ids[k]]++] = i;
+                }
+            }
+        }
+    }
+}
+
+void freeOpeningMap(OpeningMap *map) {
+    free(map->REGION);
+    free(map->START);
+    free(map->CELLS);
+    free(map->PARENT);
+    map->REGION = NULL;
+    map->START = NULL;
+    map->CELLS = NULL;
+    map->PARENT = NULL;
+    map->CAPACITY = 0;
+}
+
+void revealOpening(TILE **board, const OpeningMap *map, int x, int y, Status *status, FloodWork *work, RunBitmap *layer) {
+    int h = map->H_TILES;
+    if (x < 0 || x >= map->W_TILES || y < 0 || y >= h || board[x][y].VISIBLE
+        || board[x][y].MARK == CELL_FLAGGED || map->REGION[x * h + y] < 0) {
+        revealEmptyCells(board, x, y, status, work);
+        return;
+    }
+
+    int region = map->REGION[x * h + y];
+    const int *cell = &map->CELLS[map->START[region]];
+    int count = map->START[region + 1] - map->START[region];
+
+    // A flagged blank cuts the opening, only the flood fill knows where
+    for (int i = 0; i < count; i++) {
+        TILE *tile = &board[cell[i] / h][cell[i] % h];
+        if (tile->MARK == CELL_FLAGGED && tile->TYPE == BLANK_TILE) {
+            revealEmptyCells(board, x, y, status, work);
+            return;
+        }
+    }
+
+    int spanStart = -1, spanEnd = -1;
+    for (int i = 0; i < count; i++) {
+        TILE *tile = &board[cell[i] / h][cell[i] % h];
+        if (tile->VISIBLE || tile->MARK == CELL_FLAGGED) {
+            continue;
+        }
+        recordCellChange(work, cell[i], tile);
+        tile->VISIBLE = true;
+        status->VISIBLE_TILES += 1;
+        if (work->FRONTIER != NULL) {
+            frontierChange(work->FRONTIER, board, cell[i] / h, cell[i] % h, false, tile->MARK);
+        }
+
+        if (layer != NULL) {
+            if (cell[i] != spanEnd || cell[i] % h == 0) {
+                if (spanStart >= 0) {
+                    runBitmapSetRange(layer, spanStart / h, spanStart % h, (spanEnd - 1) % h + 1);
+                }
+                spanStart = cell[i];
+            }
+            spanEnd = cell[i] + 1;
+        }
+    }
+    if (layer != NULL && spanStart >= 0) {
+        runBitmapSetRange(layer, spanStart / h, spanStart % h, (spanEnd - 1) % h + 1);
+    }
+
+    if ((status->VISIBLE_TILES + status->BOMBS) == (status->W_TILES * status->H_TILES)) {
+        status->STATE = WIN;
+    }
+}
@@ -0,0 +1,24 @@
+#ifndef OPENINGS_H
+#define OPENINGS_H
+
+#include "game.h"
+#include "bitmap.h"
+
+// Connected zero regions of a generated board. Cells are indexed x * H_TILES + y.
+typedef struct OpeningMap {
+    int W_TILES;
+    int H_TILES;
+    int COUNT;          // number of openings
+    int BBBV;           // openings plus numbers that touch no opening
+    int *REGION;        // opening id of each blank cell, -1 for any other cell
+    int *START;         // COUNT + 1 offsets into CELLS
+    int *CELLS;         // per opening: its blanks and border numbers, sorted by index
+    int CAPACITY;
+    int *PARENT;        // union-find scratch
+} OpeningMap;
+
+void buildOpeningMap(TILE **board, Status status, OpeningMap *map);
+void freeOpeningMap(OpeningMap *map);
+void revealOpening(TILE **board, const OpeningMap *map, int x, int y, Status *status, FloodWork *work, RunBitmap *layer);
+
+#endif
@@ -0,0 +1,881 @@
+#ifndef PATTERNS_H
+#define PATTERNS_H
+
+// Generated by tools/genpatterns.c, do not edit.
+//
+// PAIR_PATTERNS[PATTERN_INDEX(shared, onlyFirst, onlySecond, firstNeeds, secondNeeds)]
+// packs a verdict for the first-only, shared and second-only groups in
+// bits 0-1, 2-3 and 4-5: 0 unknown, 1 every cell safe, 2 every cell a mine.
+
+#define PATTERN_SAFE 1
+#define PATTERN_MINE 2
+#define PATTERN_INDEX(s, a, b, ra, rb) ((((((s) - 1) * 8 + (a)) * 8 + (b)) * 9 + (ra)) * 9 + (rb))
+
+static const unsigned char PAIR_PATTERNS[4 * 8 * 8 * 9 * 9] = {
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 0, 25, 41, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 0, 25, 9, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 0, 25, 9, 9, 41, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 0, 25, 9,
+        9, 9, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 0, 25, 9, 9, 9, 9, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 0, 25, 9, 9, 9, 9, 9, 41, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        0, 25, 9, 9, 9, 9, 9, 9, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 22, 25, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 22, 0, 41, 0, 0, 0,
+        0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 41, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 22, 0, 0, 0, 41, 0, 0, 0, 0, 0, 26, 10,
+        10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 41, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 22, 0, 0, 0, 0, 0, 41, 0, 0, 0, 26, 10, 10, 10, 10, 42, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 22, 0, 0, 0, 0, 0, 0, 41, 0,
+        0, 26, 10, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 41, 0, 26, 10, 10, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 25, 0, 0, 0, 0, 0, 0, 0, 22, 24, 0, 0, 0, 0,
+        0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 41, 0, 0, 0,
+        0, 0, 0, 22, 0, 40, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 41, 0, 0, 0, 0, 0, 22, 0, 0, 40, 0, 0, 0, 0, 0, 0, 26, 10,
+        42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 22, 0, 0,
+        0, 40, 0, 0, 0, 0, 0, 26, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 22, 0, 0, 0, 0, 40, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 22, 0, 0, 0, 0, 0, 40, 0, 0,
+        0, 26, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 26, 10, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 22, 0, 0, 0, 0, 0, 0, 0, 40, 0, 26, 10, 10, 10, 10,
+        10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 25, 0, 0, 0, 0, 0, 0, 0, 20, 24, 0, 0, 0, 0,
+        0, 0, 0, 22, 24, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 41, 0, 0, 0,
+        0, 0, 0, 20, 0, 40, 0, 0, 0, 0, 0, 0, 22, 0, 40, 0, 0, 0, 0, 0, 0, 0, 26, 42,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 41, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 22, 0, 0,
+        40, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 20, 0, 0,
+        0, 40, 0, 0, 0, 0, 22, 0, 0, 0, 40, 0, 0, 0, 0, 0, 26, 10, 10, 42, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 22, 0, 0, 0, 0, 40, 0, 0, 0,
+        0, 26, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        22, 0, 0, 0, 0, 0, 40, 0, 0, 0, 26, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 26, 10, 10, 10, 10,
+        10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 22, 0, 0, 0, 0, 0,
+        0, 0, 40, 0, 26, 10, 10, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 25, 0, 0, 0, 0, 0, 0, 0, 20, 24, 0, 0, 0, 0,
+        0, 0, 0, 20, 24, 0, 0, 0, 0, 0, 0, 0, 22, 24, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 41, 0, 0, 0,
+        0, 0, 0, 20, 0, 40, 0, 0, 0, 0, 0, 0, 20, 0, 40, 0, 0, 0, 0, 0, 0, 22, 0, 40,
+        0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 41, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 20, 0, 0,
+        40, 0, 0, 0, 0, 0, 22, 0, 0, 40, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 20, 0, 0,
+        0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0, 22, 0, 0, 0, 40, 0, 0, 0, 0,
+        0, 26, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0,
+        22, 0, 0, 0, 0, 40, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        20, 0, 0, 0, 0, 0, 40, 0, 0, 22, 0, 0, 0, 0, 0, 40, 0, 0, 0, 26, 10, 10, 10, 10,
+        42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 22, 0, 0, 0, 0, 0,
+        0, 40, 0, 0, 26, 10, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0,
+        0, 0, 40, 22, 0, 0, 0, 0, 0, 0, 0, 40, 0, 26, 10, 10, 10, 10, 10, 10, 42, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 25, 0, 0, 0, 0, 0, 0, 0, 20, 24, 0, 0, 0, 0,
+        0, 0, 0, 20, 24, 0, 0, 0, 0, 0, 0, 0, 20, 24, 0, 0, 0, 0, 0, 0, 0, 22, 24, 0,
+        0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 41, 0, 0, 0,
+        0, 0, 0, 20, 0, 40, 0, 0, 0, 0, 0, 0, 20, 0, 40, 0, 0, 0, 0, 0, 0, 20, 0, 40,
+        0, 0, 0, 0, 0, 0, 22, 0, 40, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 41, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 20, 0, 0,
+        40, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 22, 0, 0, 40, 0, 0, 0, 0, 0,
+        0, 26, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 20, 0, 0,
+        0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0,
+        22, 0, 0, 0, 40, 0, 0, 0, 0, 0, 26, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0,
+        20, 0, 0, 0, 0, 40, 0, 0, 0, 22, 0, 0, 0, 0, 40, 0, 0, 0, 0, 26, 10, 10, 10, 42,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        20, 0, 0, 0, 0, 0, 40, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0, 22, 0, 0, 0, 0, 0,
+        40, 0, 0, 0, 26, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0,
+        0, 40, 0, 22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 26, 10, 10, 10, 10, 10, 42, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0,
+        0, 0, 40, 20, 0, 0, 0, 0, 0, 0, 0, 40, 22, 0, 0, 0, 0, 0, 0, 0, 40, 0, 26, 10,
+        10, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 25, 0, 0, 0, 0, 0, 0, 0, 20, 24, 0, 0, 0, 0,
+        0, 0, 0, 20, 24, 0, 0, 0, 0, 0, 0, 0, 20, 24, 0, 0, 0, 0, 0, 0, 0, 20, 24, 0,
+        0, 0, 0, 0, 0, 0, 22, 24, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 41, 0, 0, 0,
+        0, 0, 0, 20, 0, 40, 0, 0, 0, 0, 0, 0, 20, 0, 40, 0, 0, 0, 0, 0, 0, 20, 0, 40,
+        0, 0, 0, 0, 0, 0, 20, 0, 40, 0, 0, 0, 0, 0, 0, 22, 0, 40, 0, 0, 0, 0, 0, 0,
+        0, 26, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 41, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 20, 0, 0,
+        40, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0,
+        22, 0, 0, 40, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 20, 0, 0,
+        0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0,
+        20, 0, 0, 0, 40, 0, 0, 0, 0, 22, 0, 0, 0, 40, 0, 0, 0, 0, 0, 26, 10, 10, 42, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0,
+        20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 22, 0, 0, 0, 0, 40,
+        0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        20, 0, 0, 0, 0, 0, 40, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0, 20, 0, 0, 0, 0, 0,
+        40, 0, 0, 22, 0, 0, 0, 0, 0, 40, 0, 0, 0, 26, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0,
+        0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 26, 10,
+        10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0,
+        0, 0, 40, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0, 0, 0, 40, 22, 0, 0,
+        0, 0, 0, 0, 0, 40, 0, 26, 10, 10, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 25, 0, 0, 0, 0, 0, 0, 0, 20, 24, 0, 0, 0, 0,
+        0, 0, 0, 20, 24, 0, 0, 0, 0, 0, 0, 0, 20, 24, 0, 0, 0, 0, 0, 0, 0, 20, 24, 0,
+        0, 0, 0, 0, 0, 0, 20, 24, 0, 0, 0, 0, 0, 0, 0, 22, 24, 0, 0, 0, 0, 0, 0, 0,
+        0, 26, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 41, 0, 0, 0,
+        0, 0, 0, 20, 0, 40, 0, 0, 0, 0, 0, 0, 20, 0, 40, 0, 0, 0, 0, 0, 0, 20, 0, 40,
+        0, 0, 0, 0, 0, 0, 20, 0, 40, 0, 0, 0, 0, 0, 0, 20, 0, 40, 0, 0, 0, 0, 0, 0,
+        22, 0, 40, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 41, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 20, 0, 0,
+        40, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0,
+        20, 0, 0, 40, 0, 0, 0, 0, 0, 22, 0, 0, 40, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 20, 0, 0,
+        0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0,
+        20, 0, 0, 0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0, 22, 0, 0, 0, 40, 0,
+        0, 0, 0, 0, 26, 10, 10, 42, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0,
+        20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40,
+        0, 0, 0, 22, 0, 0, 0, 0, 40, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        20, 0, 0, 0, 0, 0, 40, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0, 20, 0, 0, 0, 0, 0,
+        40, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0, 22, 0, 0, 0, 0, 0, 40, 0, 0, 0, 26, 10,
+        10, 10, 10, 42, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0,
+        0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 22, 0, 0,
+        0, 0, 0, 0, 40, 0, 0, 26, 10, 10, 10, 10, 10, 42, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0,
+        0, 0, 40, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0,
+        0, 0, 0, 0, 0, 40, 22, 0, 0, 0, 0, 0, 0, 0, 40, 0, 26, 10, 10, 10, 10, 10, 10, 42,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 0, 17, 33, 0, 0, 0,
+        0, 0, 0, 0, 0, 25, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 0, 17, 1, 33, 0, 0, 0, 0, 0, 0, 0, 25, 9, 41, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 0, 17, 1, 1, 33, 0, 0, 0, 0, 0, 0, 25,
+        9, 9, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 0, 17, 1,
+        1, 1, 33, 0, 0, 0, 0, 0, 25, 9, 9, 9, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 0, 17, 1, 1, 1, 1, 33, 0, 0, 0, 0, 25, 9, 9, 9, 9, 41, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 0, 17, 1, 1, 1, 1, 1, 33, 0,
+        0, 0, 25, 9, 9, 9, 9, 9, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        0, 17, 1, 1, 1, 1, 1, 1, 33, 0, 0, 25, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 22, 17, 0, 0, 0, 0, 0, 0, 0, 0, 18, 25, 0, 0, 0,
+        0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 22, 0, 33, 0, 0, 0,
+        0, 0, 0, 0, 18, 0, 41, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 33, 0, 0, 0, 0, 0, 0, 18, 0, 0, 41, 0, 0, 0, 0, 0, 0, 26,
+        10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 22, 0, 0, 0, 33, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 41, 0, 0, 0, 0, 0, 26, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 33, 0, 0, 0, 0, 18, 0, 0, 0, 0, 41, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 22, 0, 0, 0, 0, 0, 33, 0, 0, 0, 18, 0, 0, 0, 0, 0, 41, 0,
+        0, 0, 26, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 22, 0, 0, 0, 0, 0, 0, 33, 0,
+        0, 18, 0, 0, 0, 0, 0, 0, 41, 0, 0, 26, 10, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 33, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10,
+        10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 22, 16, 25, 0, 0, 0,
+        0, 0, 0, 0, 18, 24, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 41, 0, 0, 0, 0, 0, 0, 18, 0, 40, 0, 0, 0, 0, 0, 0, 0, 26,
+        42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 22, 0, 0, 0, 41, 0, 0, 0, 0, 0, 18, 0,
+        0, 40, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 41, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 26, 10, 10, 42, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 22, 0, 0, 0, 0, 0, 41, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0,
+        0, 0, 26, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 22, 0, 0, 0, 0, 0, 0, 41, 0,
+        0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 26, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 41, 0, 18, 0, 0, 0, 0, 0, 0, 40, 0, 0, 26, 10, 10, 10,
+        10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 25, 0, 0, 0,
+        0, 0, 0, 22, 16, 24, 0, 0, 0, 0, 0, 0, 0, 18, 24, 0, 0, 0, 0, 0, 0, 0, 0, 26,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 41, 0, 0, 0, 0, 0, 22, 0, 0, 40, 0, 0, 0, 0, 0, 0, 18, 0,
+        40, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 22, 0, 0,
+        0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 22, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0,
+        0, 0, 26, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 22, 0, 0, 0, 0, 0, 40, 0, 0,
+        0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 26, 10, 10, 10,
+        10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 22, 0, 0, 0, 0, 0, 0, 0, 40, 0, 18, 0, 0, 0, 0,
+        0, 0, 40, 0, 0, 26, 10, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 10, 10, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 25, 0, 0, 0,
+        0, 0, 0, 20, 16, 24, 0, 0, 0, 0, 0, 0, 22, 16, 24, 0, 0, 0, 0, 0, 0, 0, 18, 24,
+        0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 41, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 22, 0, 0,
+        40, 0, 0, 0, 0, 0, 0, 18, 0, 40, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 20, 0, 0,
+        0, 40, 0, 0, 0, 0, 22, 0, 0, 0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0, 0,
+        0, 0, 26, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 22, 0, 0, 0, 0, 40, 0, 0, 0,
+        0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 26, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        22, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 26, 10, 10, 10,
+        42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0, 0, 0, 0,
+        0, 40, 0, 0, 0, 26, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 22, 0, 0, 0, 0, 0,
+        0, 0, 40, 0, 18, 0, 0, 0, 0, 0, 0, 40, 0, 0, 26, 10, 10, 10, 10, 10, 42, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26,
+        10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 25, 0, 0, 0,
+        0, 0, 0, 20, 16, 24, 0, 0, 0, 0, 0, 0, 20, 16, 24, 0, 0, 0, 0, 0, 0, 22, 16, 24,
+        0, 0, 0, 0, 0, 0, 0, 18, 24, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 41, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 20, 0, 0,
+        40, 0, 0, 0, 0, 0, 22, 0, 0, 40, 0, 0, 0, 0, 0, 0, 18, 0, 40, 0, 0, 0, 0, 0,
+        0, 0, 26, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 20, 0, 0,
+        0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0, 22, 0, 0, 0, 40, 0, 0, 0, 0,
+        0, 18, 0, 0, 40, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0,
+        22, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 26, 10, 10, 42,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        20, 0, 0, 0, 0, 0, 40, 0, 0, 22, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0, 0,
+        40, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 22, 0, 0, 0, 0, 0,
+        0, 40, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 26, 10, 10, 10, 10, 42, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0,
+        0, 0, 40, 22, 0, 0, 0, 0, 0, 0, 0, 40, 0, 18, 0, 0, 0, 0, 0, 0, 40, 0, 0, 26,
+        10, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 25, 0, 0, 0,
+        0, 0, 0, 20, 16, 24, 0, 0, 0, 0, 0, 0, 20, 16, 24, 0, 0, 0, 0, 0, 0, 20, 16, 24,
+        0, 0, 0, 0, 0, 0, 22, 16, 24, 0, 0, 0, 0, 0, 0, 0, 18, 24, 0, 0, 0, 0, 0, 0,
+        0, 0, 26, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 41, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 20, 0, 0,
+        40, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 22, 0, 0, 40, 0, 0, 0, 0, 0,
+        0, 18, 0, 40, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 20, 0, 0,
+        0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0,
+        22, 0, 0, 0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0,
+        20, 0, 0, 0, 0, 40, 0, 0, 0, 22, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0, 40,
+        0, 0, 0, 0, 0, 26, 10, 10, 42, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        20, 0, 0, 0, 0, 0, 40, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0, 22, 0, 0, 0, 0, 0,
+        40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0,
+        0, 40, 0, 22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 26,
+        10, 10, 10, 10, 42, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0,
+        0, 0, 40, 20, 0, 0, 0, 0, 0, 0, 0, 40, 22, 0, 0, 0, 0, 0, 0, 0, 40, 0, 18, 0,
+        0, 0, 0, 0, 0, 40, 0, 0, 26, 10, 10, 10, 10, 10, 42, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 10, 10,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 25, 0, 0, 0,
+        0, 0, 0, 20, 16, 24, 0, 0, 0, 0, 0, 0, 20, 16, 24, 0, 0, 0, 0, 0, 0, 20, 16, 24,
+        0, 0, 0, 0, 0, 0, 20, 16, 24, 0, 0, 0, 0, 0, 0, 22, 16, 24, 0, 0, 0, 0, 0, 0,
+        0, 18, 24, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 41, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 20, 0, 0,
+        40, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0, 20, 0, 0, 40, 0, 0, 0, 0, 0,
+        22, 0, 0, 40, 0, 0, 0, 0, 0, 0, 18, 0, 40, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 20, 0, 0,
+        0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0,
+        20, 0, 0, 0, 40, 0, 0, 0, 0, 22, 0, 0, 0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0,
+        20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 22, 0, 0, 0, 0, 40,
+        0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        20, 0, 0, 0, 0, 0, 40, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0, 20, 0, 0, 0, 0, 0,
+        40, 0, 0, 22, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0,
+        0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0,
+        0, 0, 0, 0, 40, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0,
+        0, 0, 40, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0, 0, 0, 40, 22, 0, 0,
+        0, 0, 0, 0, 0, 40, 0, 18, 0, 0, 0, 0, 0, 0, 40, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 0, 17, 33, 0, 0, 0,
+        0, 0, 0, 0, 0, 17, 33, 0, 0, 0, 0, 0, 0, 0, 0, 25, 41, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 0, 17, 1, 33, 0, 0, 0, 0, 0, 0, 0, 17, 1, 33, 0, 0, 0, 0, 0, 0, 0,
+        25, 9, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 0, 17, 1, 1, 33, 0, 0, 0, 0, 0, 0, 17,
+        1, 1, 33, 0, 0, 0, 0, 0, 0, 25, 9, 9, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 0, 17, 1,
+        1, 1, 33, 0, 0, 0, 0, 0, 17, 1, 1, 1, 33, 0, 0, 0, 0, 0, 25, 9, 9, 9, 41, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 0, 17, 1, 1, 1, 1, 33, 0, 0, 0, 0, 17, 1, 1, 1, 1, 33, 0,
+        0, 0, 0, 25, 9, 9, 9, 9, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 0, 17, 1, 1, 1, 1, 1, 33, 0,
+        0, 0, 17, 1, 1, 1, 1, 1, 33, 0, 0, 0, 25, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        0, 17, 1, 1, 1, 1, 1, 1, 33, 0, 0, 17, 1, 1, 1, 1, 1, 1, 0, 0, 0, 25, 9, 9,
+        9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 22, 17, 0, 0, 0, 0, 0, 0, 0, 0, 18, 17, 0, 0, 0,
+        0, 0, 0, 0, 0, 18, 25, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 22, 0, 33, 0, 0, 0,
+        0, 0, 0, 0, 18, 0, 33, 0, 0, 0, 0, 0, 0, 0, 18, 0, 41, 0, 0, 0, 0, 0, 0, 0,
+        26, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 33, 0, 0, 0, 0, 0, 0, 18, 0, 0, 33, 0, 0, 0, 0, 0, 0, 18,
+        0, 0, 41, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 22, 0, 0, 0, 33, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 33, 0, 0, 0, 0, 0, 18, 0, 0, 0, 41, 0, 0, 0, 0, 0, 26, 10, 10, 42, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 33, 0, 0, 0, 0, 18, 0, 0, 0, 0, 33, 0, 0, 0, 0, 18, 0, 0, 0, 0, 41, 0,
+        0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 22, 0, 0, 0, 0, 0, 33, 0, 0, 0, 18, 0, 0, 0, 0, 0, 33, 0,
+        0, 0, 18, 0, 0, 0, 0, 0, 41, 0, 0, 0, 26, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 22, 0, 0, 0, 0, 0, 0, 33, 0,
+        0, 18, 0, 0, 0, 0, 0, 0, 33, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10,
+        10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 33, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 22, 16, 17, 0, 0, 0,
+        0, 0, 0, 0, 18, 16, 25, 0, 0, 0, 0, 0, 0, 0, 18, 24, 0, 0, 0, 0, 0, 0, 0, 0,
+        26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 33, 0, 0, 0, 0, 0, 0, 18, 0, 0, 41, 0, 0, 0, 0, 0, 0, 18,
+        0, 40, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 22, 0, 0, 0, 33, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 41, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 33, 0, 0, 0, 0, 18, 0, 0, 0, 0, 41, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0,
+        0, 0, 0, 26, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 22, 0, 0, 0, 0, 0, 33, 0, 0, 0, 18, 0, 0, 0, 0, 0, 41, 0,
+        0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 22, 0, 0, 0, 0, 0, 0, 33, 0,
+        0, 18, 0, 0, 0, 0, 0, 0, 41, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 26, 10, 10,
+        10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 33, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 10, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 17, 0, 0, 0,
+        0, 0, 0, 22, 16, 16, 25, 0, 0, 0, 0, 0, 0, 18, 16, 24, 0, 0, 0, 0, 0, 0, 0, 18,
+        24, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 22, 0, 0, 0, 41, 0, 0, 0, 0, 0, 18, 0,
+        0, 40, 0, 0, 0, 0, 0, 0, 18, 0, 40, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 41, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0,
+        0, 0, 0, 26, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 22, 0, 0, 0, 0, 0, 41, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0,
+        0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 26, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 22, 0, 0, 0, 0, 0, 0, 41, 0,
+        0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 26, 10, 10,
+        10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 41, 0, 18, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0, 0, 0,
+        0, 0, 40, 0, 0, 0, 26, 10, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 10, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        26, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 17, 0, 0, 0,
+        0, 0, 0, 20, 16, 16, 25, 0, 0, 0, 0, 0, 22, 16, 16, 24, 0, 0, 0, 0, 0, 0, 18, 16,
+        24, 0, 0, 0, 0, 0, 0, 0, 18, 24, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 22, 0, 0,
+        0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0, 0, 0, 0, 18, 0, 40, 0, 0, 0, 0,
+        0, 0, 0, 26, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 22, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0,
+        0, 0, 18, 0, 0, 40, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 22, 0, 0, 0, 0, 0, 40, 0, 0,
+        0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 26, 10, 10,
+        42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0,
+        0, 40, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 22, 0, 0, 0, 0, 0, 0, 0, 40, 0, 18, 0, 0, 0, 0,
+        0, 0, 40, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 26, 10, 10, 10, 10, 42, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        26, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 17, 0, 0, 0,
+        0, 0, 0, 20, 16, 16, 25, 0, 0, 0, 0, 0, 20, 16, 16, 24, 0, 0, 0, 0, 0, 22, 16, 16,
+        24, 0, 0, 0, 0, 0, 0, 18, 16, 24, 0, 0, 0, 0, 0, 0, 0, 18, 24, 0, 0, 0, 0, 0,
+        0, 0, 0, 26, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 20, 0, 0,
+        0, 40, 0, 0, 0, 0, 22, 0, 0, 0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0, 0,
+        0, 0, 18, 0, 40, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 22, 0, 0, 0, 0, 40, 0, 0, 0,
+        0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0, 0, 0, 0, 26, 10, 42,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        22, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0,
+        40, 0, 0, 0, 0, 0, 26, 10, 10, 42, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0, 0, 0, 0,
+        0, 40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 22, 0, 0, 0, 0, 0,
+        0, 0, 40, 0, 18, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0,
+        26, 10, 10, 10, 10, 42, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 10, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 10,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 17, 0, 0, 0,
+        0, 0, 0, 20, 16, 16, 25, 0, 0, 0, 0, 0, 20, 16, 16, 24, 0, 0, 0, 0, 0, 20, 16, 16,
+        24, 0, 0, 0, 0, 0, 22, 16, 16, 24, 0, 0, 0, 0, 0, 0, 18, 16, 24, 0, 0, 0, 0, 0,
+        0, 0, 18, 24, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 20, 0, 0,
+        0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0, 22, 0, 0, 0, 40, 0, 0, 0, 0,
+        0, 18, 0, 0, 40, 0, 0, 0, 0, 0, 0, 18, 0, 40, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0,
+        22, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        20, 0, 0, 0, 0, 0, 40, 0, 0, 22, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0, 0,
+        40, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 22, 0, 0, 0, 0, 0,
+        0, 40, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0,
+        0, 0, 40, 22, 0, 0, 0, 0, 0, 0, 0, 40, 0, 18, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18,
+        0, 0, 0, 0, 0, 40, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 17, 0, 0, 0,
+        0, 0, 0, 20, 16, 16, 25, 0, 0, 0, 0, 0, 20, 16, 16, 24, 0, 0, 0, 0, 0, 20, 16, 16,
+        24, 0, 0, 0, 0, 0, 20, 16, 16, 24, 0, 0, 0, 0, 0, 22, 16, 16, 24, 0, 0, 0, 0, 0,
+        0, 18, 16, 24, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 41, 0, 0, 0, 0, 20, 0, 0,
+        0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0, 20, 0, 0, 0, 40, 0, 0, 0, 0,
+        22, 0, 0, 0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0,
+        20, 0, 0, 0, 0, 40, 0, 0, 0, 22, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0, 40,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        20, 0, 0, 0, 0, 0, 40, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0, 22, 0, 0, 0, 0, 0,
+        40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0,
+        0, 40, 0, 22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0,
+        0, 0, 40, 20, 0, 0, 0, 0, 0, 0, 0, 40, 22, 0, 0, 0, 0, 0, 0, 0, 40, 0, 18, 0,
+        0, 0, 0, 0, 0, 40, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 0, 17, 33, 0, 0, 0,
+        0, 0, 0, 0, 0, 17, 33, 0, 0, 0, 0, 0, 0, 0, 0, 17, 33, 0, 0, 0, 0, 0, 0, 0,
+        0, 25, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 0, 17, 1, 33, 0, 0, 0, 0, 0, 0, 0, 17, 1, 33, 0, 0, 0, 0, 0, 0, 0,
+        17, 1, 33, 0, 0, 0, 0, 0, 0, 0, 25, 9, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 0, 17, 1, 1, 33, 0, 0, 0, 0, 0, 0, 17,
+        1, 1, 33, 0, 0, 0, 0, 0, 0, 17, 1, 1, 33, 0, 0, 0, 0, 0, 0, 25, 9, 9, 41, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 0, 17, 1,
+        1, 1, 33, 0, 0, 0, 0, 0, 17, 1, 1, 1, 33, 0, 0, 0, 0, 0, 17, 1, 1, 1, 33, 0,
+        0, 0, 0, 0, 25, 9, 9, 9, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 0, 17, 1, 1, 1, 1, 33, 0, 0, 0, 0, 17, 1, 1, 1, 1, 33, 0,
+        0, 0, 0, 17, 1, 1, 1, 1, 33, 0, 0, 0, 0, 25, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 0, 17, 1, 1, 1, 1, 1, 33, 0,
+        0, 0, 17, 1, 1, 1, 1, 1, 33, 0, 0, 0, 17, 1, 1, 1, 1, 1, 0, 0, 0, 0, 25, 9,
+        9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        0, 17, 1, 1, 1, 1, 1, 1, 33, 0, 0, 17, 1, 1, 1, 1, 1, 1, 0, 0, 0, 17, 1, 1,
+        1, 1, 1, 0, 0, 0, 0, 25, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 22, 17, 0, 0, 0, 0, 0, 0, 0, 0, 18, 17, 0, 0, 0,
+        0, 0, 0, 0, 0, 18, 17, 0, 0, 0, 0, 0, 0, 0, 0, 18, 25, 0, 0, 0, 0, 0, 0, 0,
+        0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 22, 0, 33, 0, 0, 0,
+        0, 0, 0, 0, 18, 0, 33, 0, 0, 0, 0, 0, 0, 0, 18, 0, 33, 0, 0, 0, 0, 0, 0, 0,
+        18, 0, 41, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 33, 0, 0, 0, 0, 0, 0, 18, 0, 0, 33, 0, 0, 0, 0, 0, 0, 18,
+        0, 0, 33, 0, 0, 0, 0, 0, 0, 18, 0, 0, 41, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 22, 0, 0, 0, 33, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 33, 0, 0, 0, 0, 0, 18, 0, 0, 0, 33, 0, 0, 0, 0, 0, 18, 0, 0, 0, 41, 0,
+        0, 0, 0, 0, 26, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 33, 0, 0, 0, 0, 18, 0, 0, 0, 0, 33, 0, 0, 0, 0, 18, 0, 0, 0, 0, 33, 0,
+        0, 0, 0, 18, 0, 0, 0, 0, 41, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 22, 0, 0, 0, 0, 0, 33, 0, 0, 0, 18, 0, 0, 0, 0, 0, 33, 0,
+        0, 0, 18, 0, 0, 0, 0, 0, 33, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10,
+        10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 22, 0, 0, 0, 0, 0, 0, 33, 0,
+        0, 18, 0, 0, 0, 0, 0, 0, 33, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 33, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 22, 16, 17, 0, 0, 0,
+        0, 0, 0, 0, 18, 16, 17, 0, 0, 0, 0, 0, 0, 0, 18, 16, 25, 0, 0, 0, 0, 0, 0, 0,
+        18, 24, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 33, 0, 0, 0, 0, 0, 0, 18, 0, 0, 33, 0, 0, 0, 0, 0, 0, 18,
+        0, 0, 41, 0, 0, 0, 0, 0, 0, 18, 0, 40, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 22, 0, 0, 0, 33, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 33, 0, 0, 0, 0, 0, 18, 0, 0, 0, 41, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0,
+        0, 0, 0, 0, 26, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 33, 0, 0, 0, 0, 18, 0, 0, 0, 0, 33, 0, 0, 0, 0, 18, 0, 0, 0, 0, 41, 0,
+        0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 26, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 22, 0, 0, 0, 0, 0, 33, 0, 0, 0, 18, 0, 0, 0, 0, 0, 33, 0,
+        0, 0, 18, 0, 0, 0, 0, 0, 41, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 26, 10,
+        10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 22, 0, 0, 0, 0, 0, 0, 33, 0,
+        0, 18, 0, 0, 0, 0, 0, 0, 33, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 33, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 26, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 17, 0, 0, 0,
+        0, 0, 0, 22, 16, 16, 17, 0, 0, 0, 0, 0, 0, 18, 16, 16, 25, 0, 0, 0, 0, 0, 0, 18,
+        16, 24, 0, 0, 0, 0, 0, 0, 0, 18, 24, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 22, 0, 0, 0, 33, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 41, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0, 0, 0, 0, 18, 0, 40, 0, 0, 0,
+        0, 0, 0, 0, 26, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 33, 0, 0, 0, 0, 18, 0, 0, 0, 0, 41, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0,
+        0, 0, 0, 18, 0, 0, 40, 0, 0, 0, 0, 0, 0, 26, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 22, 0, 0, 0, 0, 0, 33, 0, 0, 0, 18, 0, 0, 0, 0, 0, 41, 0,
+        0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 26, 10,
+        10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 22, 0, 0, 0, 0, 0, 0, 33, 0,
+        0, 18, 0, 0, 0, 0, 0, 0, 41, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0,
+        0, 0, 40, 0, 0, 0, 0, 26, 10, 10, 10, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 33, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 26, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 17, 0, 0, 0,
+        0, 0, 0, 20, 16, 16, 17, 0, 0, 0, 0, 0, 22, 16, 16, 16, 25, 0, 0, 0, 0, 0, 18, 16,
+        16, 24, 0, 0, 0, 0, 0, 0, 18, 16, 24, 0, 0, 0, 0, 0, 0, 0, 18, 24, 0, 0, 0, 0,
+        0, 0, 0, 0, 26, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 41, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0,
+        0, 0, 0, 18, 0, 40, 0, 0, 0, 0, 0, 0, 0, 26, 42, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 22, 0, 0, 0, 0, 0, 41, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0,
+        0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0, 0, 0, 0, 26, 10,
+        42, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 22, 0, 0, 0, 0, 0, 0, 41, 0,
+        0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0,
+        0, 40, 0, 0, 0, 0, 0, 26, 10, 10, 42, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        22, 0, 0, 0, 0, 0, 0, 0, 41, 0, 18, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0, 0, 0,
+        0, 0, 40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 26, 10, 10, 10, 42, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 26, 10, 10, 10, 10, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 10, 10, 10, 10,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 17, 0, 0, 0,
+        0, 0, 0, 20, 16, 16, 17, 0, 0, 0, 0, 0, 20, 16, 16, 16, 25, 0, 0, 0, 0, 22, 16, 16,
+        16, 24, 0, 0, 0, 0, 0, 18, 16, 16, 24, 0, 0, 0, 0, 0, 0, 18, 16, 24, 0, 0, 0, 0,
+        0, 0, 0, 18, 24, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 22, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0,
+        0, 0, 18, 0, 0, 40, 0, 0, 0, 0, 0, 0, 18, 0, 40, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 22, 0, 0, 0, 0, 0, 40, 0, 0,
+        0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 18, 0, 0,
+        40, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0,
+        0, 40, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 22, 0, 0, 0, 0, 0, 0, 0, 40, 0, 18, 0, 0, 0, 0,
+        0, 0, 40, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        18, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 17, 0, 0, 0,
+        0, 0, 0, 20, 16, 16, 17, 0, 0, 0, 0, 0, 20, 16, 16, 16, 25, 0, 0, 0, 0, 20, 16, 16,
+        16, 24, 0, 0, 0, 0, 22, 16, 16, 16, 24, 0, 0, 0, 0, 0, 18, 16, 16, 24, 0, 0, 0, 0,
+        0, 0, 18, 16, 24, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 22, 0, 0, 0, 0, 40, 0, 0, 0,
+        0, 18, 0, 0, 0, 40, 0, 0, 0, 0, 0, 18, 0, 0, 40, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        22, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0,
+        40, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 22, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0, 0, 0, 0,
+        0, 40, 0, 0, 0, 18, 0, 0, 0, 0, 40, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 22, 0, 0, 0, 0, 0,
+        0, 0, 40, 0, 18, 0, 0, 0, 0, 0, 0, 40, 0, 0, 18, 0, 0, 0, 0, 0, 40, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0,
+        21, 0, 0, 0, 0, 0, 0, 0, 0, 20, 17, 0, 0, 0, 0, 0, 0, 0, 20, 16, 17, 0, 0, 0,
+        0, 0, 0, 20, 16, 16, 17, 0, 0, 0, 0, 0, 20, 16, 16, 16, 25, 0, 0, 0, 0, 20, 16, 16,
+        16, 24, 0, 0, 0, 0, 20, 16, 16, 16, 24, 0, 0, 0, 0, 22, 16, 16, 16, 24, 0, 0, 0, 0,
+        0, 18, 16, 16, 24, 0, 0, 0, 0, 21, 37, 0, 0, 0, 0, 0, 0, 0, 20, 0, 33, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 41, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0, 20, 0, 0, 0, 0, 40, 0, 0, 0,
+        22, 0, 0, 0, 0, 40, 0, 0, 0, 0, 18, 0, 0, 0, 40, 0, 0, 0, 21, 5, 37, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 33, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 41, 0, 0, 20, 0, 0, 0, 0, 0, 40, 0, 0,
+        20, 0, 0, 0, 0, 0, 40, 0, 0, 22, 0, 0, 0, 0, 0, 40, 0, 0, 0, 18, 0, 0, 0, 0,
+        40, 0, 0, 21, 5, 5, 37, 0, 0, 0, 0, 0, 20, 0, 0, 0, 33, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 41, 0,
+        20, 0, 0, 0, 0, 0, 0, 40, 0, 20, 0, 0, 0, 0, 0, 0, 40, 0, 22, 0, 0, 0, 0, 0,
+        0, 40, 0, 0, 18, 0, 0, 0, 0, 0, 40, 0, 21, 5, 5, 5, 37, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 33, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 41, 20, 0, 0, 0, 0, 0, 0, 0, 40, 20, 0, 0, 0, 0, 0,
+        0, 0, 40, 22, 0, 0, 0, 0, 0, 0, 0, 40, 0, 18, 0, 0, 0, 0, 0, 0, 40, 21, 5, 5,
+        5, 5, 37, 0, 0, 0, 20, 0, 0, 0, 0, 0, 33, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0,
+        0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 37, 0, 0, 20, 0, 0, 0, 0, 0, 0, 33, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 22, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0, 21, 5, 5, 5, 5, 5, 5, 37, 0,
+        20, 0, 0, 0, 0, 0, 0, 0, 33, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 20, 0, 0,
+        0, 0, 0, 0, 0, 0, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 0, 0, 0, 0,
+};
+
+#endif
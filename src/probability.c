@@ -0,0 +1,710 @@
+#include "probability.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Larger components are left unconstrained without searching: their
+// per-cell tables alone would grow with the square of the size
+#define MAX_COMPONENT 512
+
+typedef struct Constraint {
+    int RHS;
+    int COUNT;
+    int CELLS[8];       // frontier ids
+} Constraint;
+
+typedef struct Component {
+    int START;          // into the BFS order
+    int SIZE;
+    bool EXACT;
+    double *WAYS;       // configurations by mine count, scaled
+    double *CELL_WAYS;  // SIZE rows of SIZE + 1: configurations with that cell mined
+} Component;
+
+// One enumerated component. The key lists the component's cells in search
+// order followed by every constraint on them, all in board coordinates, so
+// a component nothing touched since the last call produces the same key.
+struct CacheEntry {
+    bool USED;
+    bool REFERENCED;
+    bool EXACT;
+    uint64_t HASH;
+    int LENGTH;
+    int *KEY;
+    int SIZE;
+    double *WAYS;
+    double *CELL_WAYS;
+    size_t BYTES;
+};
+
+typedef struct Search {
+    const Constraint *CONSTRAINTS;
+    const int *LINKS;   // 8 constraint ids per frontier cell
+    const int *LINK_COUNT;
+    int *SUM;
+    int *LEFT;
+    const int *ORDER;
+    int SIZE;
+    char *ASSIGN;
+    int MINES;
+    double *WAYS;
+    double *CELL_WAYS;
+    long NODES;
+    long BUDGET;
+    bool ABORTED;
+} Search;
+
+void probabilityInit(Probability *probability, Status status) {
+    probability->W_TILES = status.W_TILES;
+    probability->H_TILES = status.H_TILES;
+    probability->PROB = malloc(status.W_TILES * status.H_TILES * sizeof(float));
+    probability->NODE_BUDGET = 100000;
+    probability->FRONTIER = 0;
+    probability->COMPONENTS = 0;
+    probability->NODES = 0;
+    probability->EXACT = true;
+    probability->CACHE = NULL;
+}
+
+void probabilityFree(Probability *probability) {
+    free(probability->PROB);
+    probability->PROB = NULL;
+}
+
+void probabilityCacheInit(ProbabilityCache *cache, int capacity, size_t maxBytes) {
+    cache->ENTRIES = calloc(capacity, sizeof(CacheEntry));
+    cache->CAPACITY = capacity;
+    int slots = 2;
+    while (slots < 2 * capacity) {
+        slots *= 2;
+    }
+    cache->INDEX = calloc(slots, sizeof(int));
+    cache->MASK = slots - 1;
+    cache->HAND = 0;
+    cache->BYTES = 0;
+    cache->MAX_BYTES = maxBytes;
+    cache->HITS = 0;
+    cache->MISSES = 0;
+}
+
+// Empties the entry's INDEX slot, shifting back any later entry of the
+// probe run that may no longer be reachable past the gap
+static void indexRemove(ProbabilityCache *cache, const CacheEntry *entry) {
+    int id = (int) (entry - cache->ENTRIES) + 1;
+    int hole = (int) (entry->HASH & cache->MASK);
+    while (cache->INDEX[hole] != id) {
+        hole = (hole + 1) & cache->MASK;
+    }
+    for (int slot = (hole + 1) & cache->MASK; cache->INDEX[slot] != 0; slot = (slot + 1) & cache->MASK) {
+        int home = (int) (cache->ENTRIES[cache->INDEX[slot] - 1].HASH & cache->MASK);
+        // Moves when home is not cyclically within (hole, slot]
+        if (((slot - home) & cache->MASK) >= ((slot - hole) & cache->MASK)) {
+            cache->INDEX[hole] = cache->INDEX[slot];
+            hole = slot;
+        }
+    }
+    cache->INDEX[hole] = 0;
+}
+
+static void cacheEvict(ProbabilityCache *cache, CacheEntry *entry) {
+    indexRemove(cache, entry);
+    free(entry->KEY);
+    free(entry->WAYS);
+    free(entry->CELL_WAYS);
+    cache->BYTES -= entry->BYTES;
+    *entry = (CacheEntry) {0};
+}
+
+void probabilityCacheClear(ProbabilityCache *cache) {
+    for (int i = 0; i < cache->CAPACITY; i++) {
+        if (cache->ENTRIES[i].USED) {
+            cacheEvict(cache, &cache->ENTRIES[i]);
+        }
+    }
+    cache->HAND = 0;
+}
+
+void probabilityCacheFree(ProbabilityCache *cache) {
+    probabilityCacheClear(cache);
+    free(cache->ENTRIES);
+    free(cache->INDEX);
+    cache->ENTRIES = NULL;
+    cache->INDEX = NULL;
+}
+
+static uint64_t hashKey(const int *key, int length) {
+    uint64_t hash = 0x9E3779B97F4A7C15ULL ^ (uint64_t) length;
+    for (int i = 0; i < length; i++) {
+        hash = (hash ^ (uint32_t) key[i]) * 0x100000001B3ULL;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+static CacheEntry *cacheFind(ProbabilityCache *cache, uint64_t hash, const int *key, int length) {
+    for (int slot = (int) (hash & cache->MASK); cache->INDEX[slot] != 0; slot = (slot + 1) & cache->MASK) {
+        CacheEntry *entry = &cache->ENTRIES[cache->INDEX[slot] - 1];
+        if (entry->HASH == hash && entry->LENGTH == length && memcmp(entry->KEY, key, length * sizeof(int)) == 0) {
+            entry->REFERENCED = true;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Clock sweep: a referenced entry is spared once, then evicted like the rest
+// until the new entry fits the byte budget
+static void cacheStore(ProbabilityCache *cache, uint64_t hash, const int *key, int length, const Component *component) {
+    int size = component->SIZE;
+    size_t bytes = length * sizeof(int);
+    if (component->EXACT) {
+        bytes += (size + 1) * sizeof(double) + (size_t) size * (size + 1) * sizeof(double);
+    }
+    if (bytes > cache->MAX_BYTES || cache->CAPACITY == 0) {
+        return;
+    }
+
+    CacheEntry *entry;
+    for (;;) {
+        entry = &cache->ENTRIES[cache->HAND];
+        cache->HAND = (cache->HAND + 1) % cache->CAPACITY;
+        if (entry->USED && entry->REFERENCED) {
+            entry->REFERENCED = false;
+            continue;
+        }
+        if (entry->USED) {
+            cacheEvict(cache, entry);
+        }
+        if (cache->BYTES + bytes <= cache->MAX_BYTES) {
+            break;
+        }
+    }
+
+    entry->USED = true;
+    entry->REFERENCED = false;
+    entry->EXACT = component->EXACT;
+    entry->HASH = hash;
+    entry->LENGTH = length;
+    entry->KEY = malloc(length * sizeof(int));
+    memcpy(entry->KEY, key, length * sizeof(int));
+    entry->SIZE = size;
+    entry->WAYS = NULL;
+    entry->CELL_WAYS = NULL;
+    if (component->EXACT) {
+        entry->WAYS = malloc((size + 1) * sizeof(double));
+        entry->CELL_WAYS = malloc((size_t) size * (size + 1) * sizeof(double));
+        memcpy(entry->WAYS, component->WAYS, (size + 1) * sizeof(double));
+        memcpy(entry->CELL_WAYS, component->CELL_WAYS, (size_t) size * (size + 1) * sizeof(double));
+    }
+    entry->BYTES = bytes;
+    cache->BYTES += bytes;
+
+    int slot = (int) (hash & cache->MASK);
+    while (cache->INDEX[slot] != 0) {
+        slot = (slot + 1) & cache->MASK;
+    }
+    cache->INDEX[slot] = (int) (entry - cache->ENTRIES) + 1;
+}
+
+static void search(Search *s, int depth) {
+    if (s->ABORTED) {
+        return;
+    }
+    if (++s->NODES > s->BUDGET) {
+        s->ABORTED = true;
+        return;
+    }
+    if (depth == s->SIZE) {
+        s->WAYS[s->MINES] += 1;
+        for (int d = 0; d < s->SIZE; d++) {
+            if (s->ASSIGN[d]) {
+                s->CELL_WAYS[d * (s->SIZE + 1) + s->MINES] += 1;
+            }
+        }
+        return;
+    }
+
+    int f = s->ORDER[depth];
+    const int *links = &s->LINKS[f * 8];
+    for (int value = 0; value <= 1; value++) {
+        bool valid = true;
+        for (int l = 0; l < s->LINK_COUNT[f]; l++) {
+            int j = links[l];
+            s->SUM[j] += value;
+            s->LEFT[j] -= 1;
+            if (s->SUM[j] > s->CONSTRAINTS[j].RHS || s->SUM[j] + s->LEFT[j] < s->CONSTRAINTS[j].RHS) {
+                valid = false;
+            }
+        }
+        if (valid) {
+            s->ASSIGN[depth] = value;
+            s->MINES += value;
+            search(s, depth + 1);
+            s->MINES -= value;
+        }
+        for (int l = 0; l < s->LINK_COUNT[f]; l++) {
+            s->SUM[links[l]] -= value;
+            s->LEFT[links[l]] += 1;
+        }
+    }
+}
+
+static double logChoose(int n, int k) {
+    if (k < 0 || k > n) {
+        return -INFINITY;
+    }
+    return lgamma(n + 1.0) - lgamma(k + 1.0) - lgamma(n - k + 1.0);
+}
+
+// Scales values so the largest is 1; only ratios are ever read
+static void normalize(double *values, int length) {
+    double largest = 0;
+    for (int i = 0; i < length; i++) {
+        if (values[i] > largest) largest = values[i];
+    }
+    for (int i = 0; largest > 0 && i < length; i++) {
+        values[i] /= largest;
+    }
+}
+
+// result = a * b, scaled so its largest entry is 1
+static void convolve(const double *a, int aLength, const double *b, int bLength, double *result) {
+    for (int i = 0; i < aLength + bLength - 1; i++) {
+        result[i] = 0;
+    }
+    for (int i = 0; i < aLength; i++) {
+        for (int j = 0; j < bLength; j++) {
+            result[i + j] += a[i] * b[j];
+        }
+    }
+    normalize(result, aLength + bLength - 1);
+}
+
+// Mine-count distributions over a balanced tree of the components that
+// kept their search: node n covers ACTIVE[from, to), its children split
+// the range in half at 2n + 1 and 2n + 2, and a leaf points at its
+// component's WAYS. Each level holds about as many entries as the frontier
+// has cells, so the tree is O(frontier log components) where a prefix and
+// suffix table per component would be quadratic.
+typedef struct CombineTree {
+    const Component *COMPONENTS;
+    const int *ACTIVE;
+    double **DIST;
+    int *LENGTH;
+    const int *ORDER;
+    const int *FRONTIER_CELL;
+    float *PROB;
+    float INTERIOR;
+} CombineTree;
+
+static void combineBuild(CombineTree *tree, int node, int from, int to) {
+    if (to - from == 1) {
+        const Component *component = &tree->COMPONENTS[tree->ACTIVE[from]];
+        tree->DIST[node] = component->WAYS;
+        tree->LENGTH[node] = component->SIZE + 1;
+        return;
+    }
+    int mid = (from + to) / 2, left = 2 * node + 1, right = 2 * node + 2;
+    combineBuild(tree, left, from, mid);
+    combineBuild(tree, right, mid, to);
+    tree->LENGTH[node] = tree->LENGTH[left] + tree->LENGTH[right] - 1;
+    tree->DIST[node] = malloc(tree->LENGTH[node] * sizeof(double));
+    convolve(tree->DIST[left], tree->LENGTH[left], tree->DIST[right], tree->LENGTH[right], tree->DIST[node]);
+}
+
+static void combineFree(CombineTree *tree, int node, int from, int to) {
+    if (to - from == 1) {
+        return;
+    }
+    int mid = (from + to) / 2;
+    combineFree(tree, 2 * node + 1, from, mid);
+    combineFree(tree, 2 * node + 2, mid, to);
+    free(tree->DIST[node]);
+}
+
+// part[a] = sum over b of other[b] * weight[a + b] for a < length
+static void correlate(const double *other, int otherLength, const double *weight, double *part, int length) {
+    for (int a = 0; a < length; a++) {
+        part[a] = 0;
+        for (int b = 0; b < otherLength; b++) {
+            part[a] += other[b] * weight[a + b];
+        }
+    }
+    normalize(part, length);
+}
+
+// weight[s] is the weight of everything outside the node's components
+// when they hold s mines between them. Each child's weight folds in its
+// sibling's distribution, so a leaf receives the rest of the board for its
+// own component and turns it into cell probabilities.
+static void combineSpread(CombineTree *tree, int node, int from, int to, const double *weight) {
+    if (to - from == 1) {
+        const Component *component = &tree->COMPONENTS[tree->ACTIVE[from]];
+        int size = component->SIZE;
+        double z = 0;
+        for (int k = 0; k <= size; k++) {
+            z += component->WAYS[k] * weight[k];
+        }
+        for (int q = 0; q < size; q++) {
+            double mined = 0;
+            for (int k = 0; k <= size; k++) {
+                mined += component->CELL_WAYS[q * (size + 1) + k] * weight[k];
+            }
+            int cell = tree->FRONTIER_CELL[tree->ORDER[component->START + q]];
+            tree->PROB[cell] = z > 0 ? (float) (mined / z) : tree->INTERIOR;
+        }
+        return;
+    }
+    int mid = (from + to) / 2, left = 2 * node + 1, right = 2 * node + 2;
+    double *part = malloc(tree->LENGTH[node] * sizeof(double));
+    correlate(tree->DIST[right], tree->LENGTH[right], weight, part, tree->LENGTH[left]);
+    combineSpread(tree, left, from, mid, part);
+    correlate(tree->DIST[left], tree->LENGTH[left], weight, part, tree->LENGTH[right]);
+    combineSpread(tree, right, mid, to, part);
+    free(part);
+}
+
+static int componentKey(const Component *component, const int *order, const int *frontierCell,
+                        const Constraint *constraints, const int *links, const int *linkCount, int *seen, int *key) {
+    int length = 0;
+    for (int q = 0; q < component->SIZE; q++) {
+        key[length++] = frontierCell[order[component->START + q]];
+    }
+    for (int q = 0; q < component->SIZE; q++) {
+        int f = order[component->START + q];
+        for (int l = 0; l < linkCount[f]; l++) {
+            int j = links[f * 8 + l];
+            if (seen[j] == component->START) {
+                continue;
+            }
+            seen[j] = component->START;
+            key[length++] = constraints[j].RHS;
+            key[length++] = constraints[j].COUNT;
+            for (int c = 0; c < constraints[j].COUNT; c++) {
+                key[length++] = frontierCell[constraints[j].CELLS[c]];
+            }
+        }
+    }
+    return length;
+}
+
+void computeProbabilities(Probability *probability, TILE **board, Status status, const Solver *solver) {
+    int w = status.W_TILES, h = status.H_TILES, cells = w * h;
+    int *frontierId = malloc(cells * sizeof(int));
+    int *frontierCell = malloc(cells * sizeof(int));
+    Constraint *constraints = malloc(cells * sizeof(Constraint));
+    int frontier = 0, constraintCount = 0, knownMines = 0;
+
+    for (int i = 0; i < cells; i++) {
+        frontierId[i] = -1;
+        if (solver != NULL && solver->KNOWN[i] == KNOWN_MINE) {
+            knownMines += 1;
+        }
+    }
+
+    // CONSTRAINTS FROM REVEALED NUMBERS
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) {
+            if (!board[x][y].VISIBLE || board[x][y].TYPE != NUMBER) {
+                continue;
+            }
+            Constraint *constraint = &constraints[constraintCount];
+            constraint->RHS = board[x][y].AMOUNT;
+            constraint->COUNT = 0;
+            for (int nx = x - 1; nx <= x + 1; nx++) {
+                for (int ny = y - 1; ny <= y + 1; ny++) {
+                    if (nx < 0 || nx >= w || ny < 0 || ny >= h || board[nx][ny].VISIBLE) {
+                        continue;
+                    }
+                    int i = nx * h + ny;
+                    unsigned char known = solver != NULL ? solver->KNOWN[i] : KNOWN_NOTHING;
+                    if (known == KNOWN_MINE) {
+                        constraint->RHS -= 1;
+                    } else if (known == KNOWN_NOTHING) {
+                        if (frontierId[i] < 0) {
+                            frontierCell[frontier] = i;
+                            frontierId[i] = frontier++;
+                        }
+                        constraint->CELLS[constraint->COUNT++] = frontierId[i];
+                    }
+                }
+            }
+            if (constraint->COUNT > 0) {
+                constraintCount += 1;
+            }
+        }
+    }
+
+    int *links = malloc(frontier * 8 * sizeof(int));
+    int *linkCount = calloc(frontier, sizeof(int));
+    for (int j = 0; j < constraintCount; j++) {
+        for (int c = 0; c < constraints[j].COUNT; c++) {
+            int f = constraints[j].CELLS[c];
+            links[f * 8 + linkCount[f]++] = j;
+        }
+    }
+
+    // COMPONENTS IN BFS ORDER, SO NEIGHBOURING CELLS ARE ASSIGNED TOGETHER
+    int *order = malloc(frontier * sizeof(int));
+    char *visited = calloc(frontier, 1);
+    Component *components = malloc(frontier * sizeof(Component));
+    int componentCount = 0, ordered = 0;
+    for (int start = 0; start < frontier; start++) {
+        if (visited[start]) {
+            continue;
+        }
+        Component *component = &components[componentCount++];
+        component->START = ordered;
+        visited[start] = 1;
+        order[ordered++] = start;
+        for (int q = component->START; q < ordered; q++) {
+            int f = order[q];
+            for (int l = 0; l < linkCount[f]; l++) {
+                const Constraint *constraint = &constraints[links[f * 8 + l]];
+                for (int c = 0; c < constraint->COUNT; c++) {
+                    if (!visited[constraint->CELLS[c]]) {
+                        visited[constraint->CELLS[c]] = 1;
+                        order[ordered++] = constraint->CELLS[c];
+                    }
+                }
+            }
+        }
+        component->SIZE = ordered - component->START;
+    }
+
+    // ENUMERATE EACH COMPONENT
+    int *sum = calloc(constraintCount, sizeof(int));
+    int *left = malloc(constraintCount * sizeof(int));
+    for (int j = 0; j < constraintCount; j++) {
+        left[j] = constraints[j].COUNT;
+    }
+    char *assign = malloc(frontier + 1);
+    int unconstrained = 0;
+    for (int i = 0; i < cells; i++) {
+        if (!board[i / h][i % h].VISIBLE && frontierId[i] < 0 && (solver == NULL || solver->KNOWN[i] == KNOWN_NOTHING)) {
+            unconstrained += 1;
+        }
+    }
+    probability->NODES = 0;
+    probability->EXACT = true;
+
+    ProbabilityCache *cache = probability->CACHE;
+    int *seen = NULL, *key = NULL;
+    if (cache != NULL) {
+        int largest = frontier < MAX_COMPONENT ? frontier : MAX_COMPONENT;
+        seen = malloc(constraintCount * sizeof(int));
+        key = malloc((size_t) largest * 81 * sizeof(int));
+        for (int j = 0; j < constraintCount; j++) {
+            seen[j] = -1;
+        }
+    }
+
+    // Smallest first, so one hopeless component cannot spend the budget the
+    // others need
+    int *bySize = malloc(componentCount * sizeof(int));
+    int *bucket = calloc(frontier + 2, sizeof(int));
+    for (int c = 0; c < componentCount; c++) {
+        bucket[components[c].SIZE + 1] += 1;
+    }
+    for (int k = 1; k <= frontier + 1; k++) {
+        bucket[k] += bucket[k - 1];
+    }
+    for (int c = 0; c < componentCount; c++) {
+        bySize[bucket[components[c].SIZE]++] = c;
+    }
+    free(bucket);
+
+    for (int n = 0; n < componentCount; n++) {
+        Component *component = &components[bySize[n]];
+        int size = component->SIZE;
+        if (size > MAX_COMPONENT) {
+            probability->EXACT = false;
+            unconstrained += size;
+            component->SIZE = 0;
+            component->WAYS = calloc(1, sizeof(double));
+            component->CELL_WAYS = NULL;
+            component->WAYS[0] = 1;
+            continue;
+        }
+
+        uint64_t hash = 0;
+        int keyLength = 0;
+        if (cache != NULL) {
+            keyLength = componentKey(component, order, frontierCell, constraints, links, linkCount, seen, key);
+            hash = hashKey(key, keyLength);
+            CacheEntry *entry = cacheFind(cache, hash, key, keyLength);
+            cache->HITS += entry != NULL;
+            cache->MISSES += entry == NULL;
+            if (entry != NULL && !entry->EXACT) {
+                probability->EXACT = false;
+                unconstrained += size;
+                component->SIZE = 0;
+                component->WAYS = calloc(1, sizeof(double));
+                component->CELL_WAYS = NULL;
+                component->WAYS[0] = 1;
+                continue;
+            }
+            if (entry != NULL) {
+                component->EXACT = true;
+                component->WAYS = malloc((size + 1) * sizeof(double));
+                component->CELL_WAYS = malloc((size_t) size * (size + 1) * sizeof(double));
+                memcpy(component->WAYS, entry->WAYS, (size + 1) * sizeof(double));
+                memcpy(component->CELL_WAYS, entry->CELL_WAYS, (size_t) size * (size + 1) * sizeof(double));
+                continue;
+            }
+        }
+
+        long budget = probability->NODE_BUDGET - probability->NODES;
+        if (budget <= 0) {
+            probability->EXACT = false;
+            unconstrained += size;
+            component->SIZE = 0;
+            component->WAYS = calloc(1, sizeof(double));
+            component->CELL_WAYS = NULL;
+            component->WAYS[0] = 1;
+            continue;
+        }
+        component->WAYS = calloc(size + 1, sizeof(double));
+        component->CELL_WAYS = calloc((size_t) size * (size + 1), sizeof(double));
+        Search s = {
+                .CONSTRAINTS = constraints,
+                .LINKS = links,
+                .LINK_COUNT = linkCount,
+                .SUM = sum,
+                .LEFT = left,
+                .ORDER = &order[component->START],
+                .SIZE = size,
+                .ASSIGN = assign,
+                .WAYS = component->WAYS,
+                .CELL_WAYS = component->CELL_WAYS,
+                .BUDGET = budget
+        };
+        search(&s, 0);
+        probability->NODES += s.NODES;
+
+        double largest = 0;
+        for (int k = 0; k <= size; k++) {
+            if (component->WAYS[k] > largest) largest = component->WAYS[k];
+        }
+        component->EXACT = !s.ABORTED && largest > 0;
+        if (!component->EXACT) {
+            // Aborted searches leave SUM and LEFT half unwound
+            for (int q = 0; q < size; q++) {
+                int f = order[component->START + q];
+                for (int l = 0; l < linkCount[f]; l++) {
+                    int j = links[f * 8 + l];
+                    sum[j] = 0;
+                    left[j] = constraints[j].COUNT;
+                }
+            }
+            // Only a search that had the whole budget proves the component
+            // too big; one cut short by the components before it may fit
+            // next time
+            if (cache != NULL && (!s.ABORTED || budget == probability->NODE_BUDGET)) {
+                cacheStore(cache, hash, key, keyLength, component);
+            }
+            probability->EXACT = false;
+            unconstrained += size;
+            component->SIZE = 0;
+            component->WAYS[0] = 1;
+            continue;
+        }
+        for (int k = 0; k <= size; k++) {
+            component->WAYS[k] /= largest;
+        }
+        for (long k = 0; k < (long) size * (size + 1); k++) {
+            component->CELL_WAYS[k] /= largest;
+        }
+        if (cache != NULL) {
+            cacheStore(cache, hash, key, keyLength, component);
+        }
+    }
+
+    // COMBINE WITH THE REMAINING MINES
+    int total = 0;
+    for (int c = 0; c < componentCount; c++) {
+        total += components[c].SIZE;
+    }
+    int remaining = status.BOMBS - knownMines;
+    double *binomial = malloc((total + 1) * sizeof(double));
+    double top = -INFINITY;
+    for (int s = 0; s <= total; s++) {
+        binomial[s] = logChoose(unconstrained, remaining - s);
+        if (binomial[s] > top) top = binomial[s];
+    }
+    for (int s = 0; s <= total; s++) {
+        binomial[s] = isinf(top) ? 0 : exp(binomial[s] - top);
+    }
+
+    int active = 0;
+    for (int c = 0; c < componentCount; c++) {
+        if (components[c].SIZE > 0) {
+            bySize[active++] = c;
+        }
+    }
+    CombineTree tree = {
+            .COMPONENTS = components,
+            .ACTIVE = bySize,
+            .DIST = malloc((size_t) 4 * active * sizeof(double *)),
+            .LENGTH = malloc((size_t) 4 * active * sizeof(int)),
+            .ORDER = order,
+            .FRONTIER_CELL = frontierCell,
+            .PROB = probability->PROB
+    };
+    double one = 1;
+    const double *all = &one;
+    int allLength = 1;
+    if (active > 0) {
+        combineBuild(&tree, 0, 0, active);
+        all = tree.DIST[0];
+        allLength = tree.LENGTH[0];
+    }
+
+    double weight = 0, interiorMines = 0;
+    for (int s = 0; s < allLength; s++) {
+        weight += all[s] * binomial[s];
+        interiorMines += all[s] * binomial[s] * (remaining - s);
+    }
+    float interior = unconstrained > 0 && weight > 0 ? (float) (interiorMines / weight / unconstrained) : 0;
+
+    for (int i = 0; i < cells; i++) {
+        if (board[i / h][i % h].VISIBLE) {
+            probability->PROB[i] = -1;
+        } else if (solver != NULL && solver->KNOWN[i] != KNOWN_NOTHING) {
+            probability->PROB[i] = solver->KNOWN[i] == KNOWN_MINE ? 1 : 0;
+        } else {
+            probability->PROB[i] = interior;
+        }
+    }
+    if (active > 0) {
+        tree.INTERIOR = interior;
+        combineSpread(&tree, 0, 0, active, binomial);
+        combineFree(&tree, 0, 0, active);
+    }
+    free(tree.DIST);
+    free(tree.LENGTH);
+
+    probability->FRONTIER = frontier;
+    probability->COMPONENTS = componentCount;
+
+    for (int c = 0; c < componentCount; c++) {
+        free(components[c].WAYS);
+        free(components[c].CELL_WAYS);
+    }
+    free(seen);
+    free(key);
+    free(bySize);
+    free(binomial);
+    free(assign);
+    free(sum);
+    free(left);
+    free(components);
+    free(visited);
+    free(order);
+    free(links);
+    free(linkCount);
+    free(constraints);
+    free(frontierCell);
+    free(frontierId);
+}
@@ -0,0 +1,56 @@
+#ifndef PROBABILITY_H
+#define PROBABILITY_H
+
+#include <stddef.h>
+#include "game.h"
+#include "solver.h"
+
+typedef struct CacheEntry CacheEntry;
+
+// Bounded cache of enumerated components with clock eviction. Successive
+// positions of one game mostly share their frontier components, and a
+// component whose cells and constraints are unchanged reuses its
+// configuration counts instead of searching again. Bounded by both entry
+// count and bytes, since one large component holds SIZE^2 doubles. Entries
+// are found through INDEX, an open addressing table of entry numbers plus
+// one (0 for an empty slot) with linear probing on the key hash, at most
+// half full.
+typedef struct ProbabilityCache {
+    CacheEntry *ENTRIES;
+    int CAPACITY;
+    int *INDEX;
+    int MASK;               // INDEX holds MASK + 1 slots
+    int HAND;
+    size_t BYTES;
+    size_t MAX_BYTES;
+    long HITS;
+    long MISSES;
+} ProbabilityCache;
+
+// Exact mine probabilities for the current position. The frontier is split
+// into independent components, each one enumerated on its own, and the
+// components are combined with the remaining mine count through binomial
+// weights in log space. NODE_BUDGET bounds the search nodes of the whole
+// call: components are searched smallest first out of one shared budget,
+// and any that would overrun what is left is treated as unconstrained and
+// clears EXACT.
+typedef struct Probability {
+    int W_TILES;
+    int H_TILES;
+    float *PROB;        // per cell, -1 for revealed cells
+    int FRONTIER;
+    int COMPONENTS;
+    long NODES;
+    long NODE_BUDGET;       // per call, across every component
+    bool EXACT;
+    ProbabilityCache *CACHE;    // optional, NULL searches every component
+} Probability;
+
+void probabilityInit(Probability *probability, Status status);
+void probabilityFree(Probability *probability);
+void probabilityCacheInit(ProbabilityCache *cache, int capacity, size_t maxBytes);
+void probabilityCacheClear(ProbabilityCache *cache);
+void probabilityCacheFree(ProbabilityCache *cache);
+void computeProbabilities(Probability *probability, TILE **board, Status status, const Solver *solver);
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+// Small seedable generator (splitmix64) for reproducible boards; rand()
+// keeps one hidden global state, which the generators cannot share or split.
+typedef struct Rng {
+    uint64_t STATE;
+} Rng;
+
+static inline uint64_t rngNext(Rng *rng) {
+    uint64_t z = (rng->STATE += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// Uniform in [0, n) without a division
+static inline int rngRange(Rng *rng, int n) {
+    return (int) (((rngNext(rng) >> 32) * (uint64_t) n) >> 32);
+}
+
+// Independent stream number `stream` of a seed, so parallel generators can
+// each draw their own sequence and still reproduce the same boards
+static inline Rng rngStream(uint64_t seed, uint64_t stream) {
+    Rng rng = {seed};
+    rng.STATE = rngNext(&rng) ^ (stream * 0xD1B54A32D192ED03ULL);
+    return rng;
+}
+
+#endif
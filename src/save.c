@@ -0,0 +1,106 @@
+#include "save.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+size_t saveGameSize(Status status) {
+    return sizeof(SaveHeader) + (size_t) status.W_TILES * status.H_TILES;
+}
+
+size_t saveGame(TILE **board, Status status, unsigned char *buffer) {
+    SaveHeader header = {
+            .MAGIC = SAVE_MAGIC,
+            .VERSION = SAVE_VERSION,
+            .W_TILES = status.W_TILES,
+            .H_TILES = status.H_TILES,
+            .BOMBS = status.BOMBS,
+            .VISIBLE_TILES = status.VISIBLE_TILES,
+            .STATE = status.STATE,
+            .FIRST_CELL = status.FIRST_CELL
+    };
+    memcpy(buffer, &header, sizeof(header));
+
+    unsigned char *cell = buffer + sizeof(header);
+    for (int x = 0; x < status.W_TILES; x++) {
+        const TILE *column = board[x];
+        for (int y = 0; y < status.H_TILES; y++) {
+            int value = column[y].TYPE >= MINE ? 9 : column[y].AMOUNT;
+            *cell++ = value | column[y].MARK << 4 | column[y].VISIBLE << 6;
+        }
+    }
+    return cell - buffer;
+}
+
+bool loadGame(const unsigned char *data, size_t size, TILE **board, Status *status) {
+    SaveHeader header;
+    if (size < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, data, sizeof(header));
+    if (header.MAGIC != SAVE_MAGIC || header.VERSION != SAVE_VERSION
+        || header.W_TILES != status->W_TILES || header.H_TILES != status->H_TILES
+        || size < sizeof(header) + (size_t) header.W_TILES * header.H_TILES
+        || header.STATE < START || header.STATE > LOSE
+        || header.FIRST_CELL < BLANK_TILE || header.FIRST_CELL > ANY) {
+        return false;
+    }
+    int cells = header.W_TILES * header.H_TILES;
+    if (header.BOMBS < 0 || header.BOMBS > cells || header.VISIBLE_TILES < 0 || header.VISIBLE_TILES > cells) {
+        return false;
+    }
+    // Every byte is checked before the board is touched, so a bad file
+    // leaves the game as it was
+    for (int i = 0; i < cells; i++) {
+        unsigned char byte = data[sizeof(header) + i];
+        if ((byte & 15) > 9 || (byte >> 4 & 3) > CELL_QUESTIONED || byte >> 7) {
+            return false;
+        }
+    }
+
+    const unsigned char *cell = data + sizeof(header);
+    for (int x = 0; x < header.W_TILES; x++) {
+        TILE *column = board[x];
+        for (int y = 0; y < header.H_TILES; y++) {
+            int value = *cell & 15;
+            bool visible = (*cell >> 6) & 1;
+            column[y].TYPE = value == 9 ? (visible ? MINE_EXPLOSION : MINE) : (value ? NUMBER : BLANK_TILE);
+            column[y].AMOUNT = value == 9 ? 0 : value;
+            column[y].MARK = (*cell >> 4) & 3;
+            column[y].VISIBLE = visible;
+            cell++;
+        }
+    }
+
+    status->BOMBS = header.BOMBS;
+    status->VISIBLE_TILES = header.VISIBLE_TILES;
+    status->STATE = header.STATE;
+    status->FIRST_CELL = header.FIRST_CELL;
+    return true;
+}
+
+bool saveGameFile(const char *path, TILE **board, Status status) {
+    size_t size = saveGameSize(status);
+    unsigned char *buffer = malloc(size);
+    saveGame(board, status, buffer);
+
+    FILE *file = fopen(path, "wb");
+    bool ok = file != NULL && fwrite(buffer, 1, size, file) == size;
+    if (file != NULL && fclose(file) != 0) {
+        ok = false;
+    }
+    free(buffer);
+    return ok;
+}
+
+bool loadGameFile(const char *path, TILE **board, Status *status) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    size_t size = saveGameSize(*status);
+    unsigned char *buffer = malloc(size);
+    bool ok = fread(buffer, 1, size, file) == size && loadGame(buffer, size, board, status);
+    fclose(file);
+    free(buffer);
+    return ok;
+}
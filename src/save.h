@@ -0,0 +1,31 @@
+#ifndef SAVE_H
+#define SAVE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "game.h"
+
+#define SAVE_MAGIC 0x5653534D       // "MSSV" in little endian
+#define SAVE_VERSION 1
+
+// Snapshot layout: this header followed by W_TILES * H_TILES cell bytes in
+// board[x][y] order. Each byte is (MINE ? 9 : AMOUNT) | MARK << 4 | VISIBLE << 6;
+// a visible mine is the MINE_EXPLOSION. Fields are in host byte order.
+typedef struct SaveHeader {
+    uint32_t MAGIC;
+    uint32_t VERSION;
+    int32_t W_TILES;
+    int32_t H_TILES;
+    int32_t BOMBS;
+    int32_t VISIBLE_TILES;
+    int32_t STATE;
+    int32_t FIRST_CELL;
+} SaveHeader;
+
+size_t saveGameSize(Status status);
+size_t saveGame(TILE **board, Status status, unsigned char *buffer);
+bool loadGame(const unsigned char *data, size_t size, TILE **board, Status *status);
+bool saveGameFile(const char *path, TILE **board, Status status);
+bool loadGameFile(const char *path, TILE **board, Status *status);
+
+#endif
@@ -0,0 +1,133 @@
+#include "sliced.h"
+#include <stdlib.h>
+#include <string.h>
+
+void slicedInit(SlicedBoards *sliced, int width, int height) {
+    int cells = width * height;
+    sliced->W_TILES = width;
+    sliced->H_TILES = height;
+    sliced->MINE = malloc(cells * sizeof(uint64_t));
+    sliced->BLANK = malloc(cells * sizeof(uint64_t));
+    sliced->VISIBLE = malloc(cells * sizeof(uint64_t));
+    sliced->FLAGGED = malloc(cells * sizeof(uint64_t));
+    sliced->PENDING = malloc(cells * sizeof(uint64_t));
+    sliced->SPREAD = malloc(cells * sizeof(uint64_t));
+    slicedClear(sliced);
+}
+
+void slicedFree(SlicedBoards *sliced) {
+    free(sliced->MINE);
+    free(sliced->BLANK);
+    free(sliced->VISIBLE);
+    free(sliced->FLAGGED);
+    free(sliced->PENDING);
+    free(sliced->SPREAD);
+    sliced->MINE = NULL;
+}
+
+void slicedClear(SlicedBoards *sliced) {
+    size_t bytes = sliced->W_TILES * sliced->H_TILES * sizeof(uint64_t);
+    memset(sliced->MINE, 0, bytes);
+    memset(sliced->BLANK, 0, bytes);
+    memset(sliced->VISIBLE, 0, bytes);
+    memset(sliced->FLAGGED, 0, bytes);
+    memset(sliced->PENDING, 0, bytes);
+    sliced->LOST = 0;
+    sliced->WON = 0;
+}
+
+// Empty slot b: no mines, nothing visible or flagged, not lost or won
+void slicedClearBoard(SlicedBoards *sliced, int b) {
+    uint64_t keep = ~((uint64_t) 1 << b);
+    for (int i = 0; i < sliced->W_TILES * sliced->H_TILES; i++) {
+        sliced->MINE[i] &= keep;
+        sliced->VISIBLE[i] &= keep;
+        sliced->FLAGGED[i] &= keep;
+    }
+    sliced->LOST &= keep;
+    sliced->WON &= keep;
+}
+
+// Copy a scalar board into slot b: mines, visibility and flags. BLANK is
+// stale until the next slicedNumbers.
+void slicedLoad(SlicedBoards *sliced, int b, TILE **board) {
+    uint64_t bit = (uint64_t) 1 << b;
+    slicedClearBoard(sliced, b);
+    for (int x = 0; x < sliced->W_TILES; x++) {
+        for (int y = 0; y < sliced->H_TILES; y++) {
+            int i = x * sliced->H_TILES + y;
+            const TILE *tile = &board[x][y];
+            if (tile->TYPE == MINE || tile->TYPE == MINE_EXPLOSION) sliced->MINE[i] |= bit;
+            if (tile->VISIBLE) sliced->VISIBLE[i] |= bit;
+            if (tile->MARK == CELL_FLAGGED) sliced->FLAGGED[i] |= bit;
+        }
+    }
+}
+
+// BLANK from MINE for all boards at once: a cell is blank when neither it
+// nor any neighbour holds a mine
+void slicedNumbers(SlicedBoards *sliced) {
+    int w = sliced->W_TILES, h = sliced->H_TILES;
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) {
+            uint64_t near = 0;
+            for (int nx = x - 1; nx <= x + 1; nx++) {
+                for (int ny = y - 1; ny <= y + 1; ny++) {
+                    if (nx >= 0 && nx < w && ny >= 0 && ny < h) {
+                        near |= sliced->MINE[nx * h + ny];
+                    }
+                }
+            }
+            sliced->BLANK[x * h + y] = ~near;
+        }
+    }
+}
+
+// cells[b] is the cell board b reveals, -1 to leave it alone
+void slicedReveal(SlicedBoards *sliced, const int *cells) {
+    int w = sliced->W_TILES, h = sliced->H_TILES, count = w * h;
+    uint64_t *pending = sliced->PENDING, *spread = sliced->SPREAD;
+    for (int b = 0; b < SLICED_BOARDS; b++) {
+        if (cells[b] >= 0) {
+            pending[cells[b]] |= (uint64_t) 1 << b;
+        }
+    }
+
+    uint64_t any = 1;
+    while (any) {
+        // Open this ring; blanks among it push the fill one cell further
+        any = 0;
+        for (int i = 0; i < count; i++) {
+            uint64_t opened = pending[i] & ~sliced->VISIBLE[i] & ~sliced->FLAGGED[i];
+            pending[i] = 0;
+            sliced->VISIBLE[i] |= opened;
+            sliced->LOST |= opened & sliced->MINE[i];
+            spread[i] = opened & sliced->BLANK[i];
+            any |= spread[i];
+        }
+        if (!any) {
+            break;
+        }
+        for (int x = 0; x < w; x++) {
+            for (int y = 0; y < h; y++) {
+                uint64_t from = spread[x * h + y];
+                if (!from) {
+                    continue;
+                }
+                for (int nx = x - 1; nx <= x + 1; nx++) {
+                    for (int ny = y - 1; ny <= y + 1; ny++) {
+                        if (nx >= 0 && nx < w && ny >= 0 && ny < h) {
+                            pending[nx * h + ny] |= from;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    uint64_t unfinished = 0;
+    for (int i = 0; i < count; i++) {
+        unfinished |= ~sliced->MINE[i] & ~sliced->VISIBLE[i];
+    }
+    sliced->WON = ~unfinished & ~sliced->LOST;
+}
@@ -0,0 +1,36 @@
+#ifndef SLICED_H
+#define SLICED_H
+
+#include <stdint.h>
+#include "game.h"
+
+#define SLICED_BOARDS 64
+
+// SLICED_BOARDS small boards of one size, bit-sliced: word i of a layer
+// holds cell i (x * H_TILES + y) of every board, bit b for board b. A
+// flood fill then advances one ring on all boards with a handful of word
+// operations per cell. Follows revealEmptyCells: flagged cells stop the
+// fill, a mine ends the game but the rest of the fill still opens, and a
+// board counts as won once every safe cell is visible and it has not lost.
+typedef struct SlicedBoards {
+    int W_TILES;
+    int H_TILES;
+    uint64_t *MINE;
+    uint64_t *BLANK;        // safe cells with no mine around
+    uint64_t *VISIBLE;
+    uint64_t *FLAGGED;
+    uint64_t *PENDING;      // scratch for the fill
+    uint64_t *SPREAD;
+    uint64_t LOST;
+    uint64_t WON;
+} SlicedBoards;
+
+void slicedInit(SlicedBoards *sliced, int width, int height);
+void slicedFree(SlicedBoards *sliced);
+void slicedClear(SlicedBoards *sliced);
+void slicedClearBoard(SlicedBoards *sliced, int b);
+void slicedLoad(SlicedBoards *sliced, int b, TILE **board);
+void slicedNumbers(SlicedBoards *sliced);
+void slicedReveal(SlicedBoards *sliced, const int *cells);
+
+#endif
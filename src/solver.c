@@ -0,0 +1,444 @@
+#include "solver.h"
+#include "patterns.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Neighbourhoods are compared as bit masks over the 7x7 window around the
+// number being examined: bit (dx + 3) * 7 + (dy + 3).
+#define WINDOW_BIT(dx, dy) ((uint64_t) 1 << (((dx) + 3) * 7 + (dy) + 3))
+
+// Components whose matrix would hold more entries fall back to propagation
+#define LINEAR_MAX_ENTRIES (1 << 22)
+
+void solverInit(Solver *solver, Status status) {
+    int cells = status.W_TILES * status.H_TILES;
+    solver->W_TILES = status.W_TILES;
+    solver->H_TILES = status.H_TILES;
+    solver->KNOWN = malloc(cells);
+    solver->QUEUED = malloc(cells);
+    solver->QUEUE = malloc(cells * sizeof(int));
+    solver->SAFE = malloc(cells * sizeof(int));
+    solver->MINES = malloc(cells * sizeof(int));
+    solver->COLUMN = malloc(cells * sizeof(int));
+    solver->SYSTEM = malloc(3 * cells * sizeof(int));
+    solver->BACKEND = SOLVER_PROPAGATION;
+    for (int i = 0; i < cells; i++) {
+        solver->COLUMN[i] = -1;
+    }
+    solverReset(solver);
+}
+
+void solverFree(Solver *solver) {
+    free(solver->KNOWN);
+    free(solver->QUEUED);
+    free(solver->QUEUE);
+    free(solver->SAFE);
+    free(solver->MINES);
+    free(solver->COLUMN);
+    free(solver->SYSTEM);
+    solver->KNOWN = NULL;
+}
+
+void solverReset(Solver *solver) {
+    int cells = solver->W_TILES * solver->H_TILES;
+    memset(solver->KNOWN, KNOWN_NOTHING, cells);
+    memset(solver->QUEUED, 0, cells);
+    solver->QUEUE_COUNT = 0;
+    solver->SAFE_COUNT = 0;
+    solver->MINE_COUNT = 0;
+}
+
+static void enqueue(Solver *solver, TILE **board, int x, int y) {
+    int i = x * solver->H_TILES + y;
+    if (!solver->QUEUED[i] && board[x][y].VISIBLE && board[x][y].TYPE == NUMBER) {
+        solver->QUEUED[i] = 1;
+        solver->QUEUE[solver->QUEUE_COUNT++] = i;
+    }
+}
+
+static void enqueueAround(Solver *solver, TILE **board, int x, int y) {
+    for (int nx = x - 1; nx <= x + 1; nx++) {
+        for (int ny = y - 1; ny <= y + 1; ny++) {
+            if (nx >= 0 && nx < solver->W_TILES && ny >= 0 && ny < solver->H_TILES) {
+                enqueue(solver, board, nx, ny);
+            }
+        }
+    }
+}
+
+static void noteRevealed(Solver *solver, TILE **board, int x, int y) {
+    int i = x * solver->H_TILES + y;
+    if (solver->KNOWN[i] == KNOWN_NOTHING) {
+        solver->KNOWN[i] = board[x][y].TYPE == MINE_EXPLOSION ? KNOWN_MINE : KNOWN_SAFE;
+    }
+    enqueueAround(solver, board, x, y);
+}
+
+void solverScan(Solver *solver, TILE **board, Status status) {
+    for (int x = 0; x < status.W_TILES; x++) {
+        for (int y = 0; y < status.H_TILES; y++) {
+            if (board[x][y].VISIBLE) {
+                noteRevealed(solver, board, x, y);
+            }
+        }
+    }
+}
+
+// Requeue the numbers around a cell whose neighbourhood changed without a
+// reveal, e.g. a mine moved by a generator
+void solverTouch(Solver *solver, TILE **board, int x, int y) {
+    enqueueAround(solver, board, x, y);
+}
+
+void solverUpdate(Solver *solver, TILE **board, Status status, const FloodWork *work) {
+    for (int c = 0; c < work->CHANGE_COUNT; c++) {
+        int i = work->CHANGES[c] >> 4;
+        int x = i / status.H_TILES, y = i % status.H_TILES;
+        if (board[x][y].VISIBLE) {
+            noteRevealed(solver, board, x, y);
+        }
+    }
+}
+
+// Unknown neighbours of (x, y) as a mask in the window centred on (cx, cy)
+static uint64_t unknownMask(const Solver *solver, TILE **board, int x, int y, int cx, int cy, int *mines) {
+    uint64_t mask = 0;
+    *mines = 0;
+    for (int nx = x - 1; nx <= x + 1; nx++) {
+        for (int ny = y - 1; ny <= y + 1; ny++) {
+            if (nx < 0 || nx >= solver->W_TILES || ny < 0 || ny >= solver->H_TILES || board[nx][ny].VISIBLE) {
+                continue;
+            }
+            unsigned char known = solver->KNOWN[nx * solver->H_TILES + ny];
+            if (known == KNOWN_MINE) {
+                *mines += 1;
+            } else if (known == KNOWN_NOTHING) {
+                mask |= WINDOW_BIT(nx - cx, ny - cy);
+            }
+        }
+    }
+    return mask;
+}
+
+static void deduceCell(Solver *solver, TILE **board, int i, Knowledge knowledge) {
+    if (solver->KNOWN[i] != KNOWN_NOTHING) {
+        return;
+    }
+    solver->KNOWN[i] = knowledge;
+    if (knowledge == KNOWN_SAFE) {
+        solver->SAFE[solver->SAFE_COUNT++] = i;
+    } else {
+        solver->MINES[solver->MINE_COUNT++] = i;
+    }
+    enqueueAround(solver, board, i / solver->H_TILES, i % solver->H_TILES);
+}
+
+static void deduce(Solver *solver, TILE **board, uint64_t mask, int cx, int cy, Knowledge knowledge) {
+    while (mask) {
+        int bit = __builtin_ctzll(mask);
+        mask &= mask - 1;
+        deduceCell(solver, board, (cx + bit / 7 - 3) * solver->H_TILES + cy + bit % 7 - 3, knowledge);
+    }
+}
+
+static void examine(Solver *solver, TILE **board, Status status, int i) {
+    int cx = i / status.H_TILES, cy = i % status.H_TILES;
+
+    // SINGLE CELL: the number is already satisfied or needs every unknown
+    int mines;
+    uint64_t mask = unknownMask(solver, board, cx, cy, cx, cy, &mines);
+    if (mask == 0) {
+        return;
+    }
+    int remaining = board[cx][cy].AMOUNT - mines;
+    if (remaining == 0) {
+        deduce(solver, board, mask, cx, cy, KNOWN_SAFE);
+        return;
+    }
+    if (remaining == __builtin_popcountll(mask)) {
+        deduce(solver, board, mask, cx, cy, KNOWN_MINE);
+        return;
+    }
+
+    // PAIRS: numbers up to two cells away that share unknowns with this one,
+    // settled by the precomputed table in patterns.h
+    for (int dx = cx - 2; dx <= cx + 2; dx++) {
+        for (int dy = cy - 2; dy <= cy + 2; dy++) {
+            if (dx < 0 || dx >= status.W_TILES || dy < 0 || dy >= status.H_TILES || (dx == cx && dy == cy)
+                || !board[dx][dy].VISIBLE || board[dx][dy].TYPE != NUMBER) {
+                continue;
+            }
+            int otherMines;
+            uint64_t other = unknownMask(solver, board, dx, dy, cx, cy, &otherMines);
+            if ((other & mask) == 0) {
+                continue;
+            }
+            int otherRemaining = board[dx][dy].AMOUNT - otherMines;
+            uint64_t groups[3] = {mask & ~other, mask & other, other & ~mask};
+            unsigned char packed = PAIR_PATTERNS[PATTERN_INDEX(__builtin_popcountll(groups[1]),
+                                                               __builtin_popcountll(groups[0]),
+                                                               __builtin_popcountll(groups[2]),
+                                                               remaining, otherRemaining)];
+            uint64_t safe = 0, mined = 0;
+            for (int g = 0; g < 3; g++) {
+                int verdict = packed >> (2 * g) & 3;
+                if (verdict == PATTERN_SAFE) safe |= groups[g];
+                if (verdict == PATTERN_MINE) mined |= groups[g];
+            }
+            if ((safe | mined) == 0) {
+                continue;
+            }
+            deduce(solver, board, mined, cx, cy, KNOWN_MINE);
+            deduce(solver, board, safe, cx, cy, KNOWN_SAFE);
+            enqueue(solver, board, cx, cy);
+            dx = cx + 3;
+            break;
+        }
+    }
+}
+
+static int64_t gcd64(int64_t a, int64_t b) {
+    if (a < 0) a = -a;
+    if (b < 0) b = -b;
+    while (b) {
+        int64_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// Bounds rule on one row of sum(a_j * x_j) = rhs with x_j in {0, 1}: when the
+// right side equals the largest or smallest reachable sum every variable is fixed
+static void boundRow(Solver *solver, TILE **board, const int64_t *row, const uint64_t *support, int words, int n,
+                     const int *cols) {
+    int64_t highest = 0, lowest = 0;
+    for (int w = 0; w < words; w++) {
+        for (uint64_t bits = support[w]; bits; bits &= bits - 1) {
+            int64_t a = row[w * 64 + __builtin_ctzll(bits)];
+            if (a > 0) highest += a; else lowest += a;
+        }
+    }
+    if (row[n] != highest && row[n] != lowest) {
+        return;
+    }
+    bool top = row[n] == highest;
+    for (int w = 0; w < words; w++) {
+        for (uint64_t bits = support[w]; bits; bits &= bits - 1) {
+            int j = w * 64 + __builtin_ctzll(bits);
+            deduceCell(solver, board, cols[j], (row[j] > 0) == top ? KNOWN_MINE : KNOWN_SAFE);
+        }
+    }
+}
+
+// Coefficients past this stop the elimination: products of two of them are
+// checked anyway, and boundRow's sums stay in range for any row length
+#define COEFFICIENT_LIMIT ((int64_t) 1 << 32)
+
+// a * x - b * y into result, false when it overflows or leaves the limit
+static bool combineTerms(int64_t a, int64_t x, int64_t b, int64_t y, int64_t *result) {
+    int64_t ax, by;
+    if (__builtin_mul_overflow(a, x, &ax) || __builtin_mul_overflow(b, y, &by) || __builtin_sub_overflow(ax, by, result)) {
+        return false;
+    }
+    return *result <= COEFFICIENT_LIMIT && *result >= -COEFFICIENT_LIMIT;
+}
+
+// Fraction-free Gauss-Jordan elimination of one frontier component. Row
+// supports are kept as bitsets so row operations only visit nonzero columns.
+// A row whose coefficients outgrow COEFFICIENT_LIMIT ends the component's
+// elimination with only the single-number deductions made.
+static void eliminate(Solver *solver, TILE **board, Status status, const int *rows, int m, const int *cols, int n) {
+    int words = (n + 63) / 64;
+    int64_t *matrix = calloc((size_t) m * (n + 1), sizeof(int64_t));
+    uint64_t *support = calloc((size_t) m * words, sizeof(uint64_t));
+    int colStart = solver->COLUMN[cols[0]];
+
+    for (int r = 0; r < m; r++) {
+        int x = rows[r] / status.H_TILES, y = rows[r] % status.H_TILES;
+        int64_t *row = &matrix[(size_t) r * (n + 1)];
+        row[n] = board[x][y].AMOUNT;
+        for (int nx = x - 1; nx <= x + 1; nx++) {
+            for (int ny = y - 1; ny <= y + 1; ny++) {
+                if (nx < 0 || nx >= status.W_TILES || ny < 0 || ny >= status.H_TILES || board[nx][ny].VISIBLE) {
+                    continue;
+                }
+                int i = nx * status.H_TILES + ny;
+                if (solver->KNOWN[i] == KNOWN_MINE) {
+                    row[n] -= 1;
+                } else if (solver->KNOWN[i] == KNOWN_NOTHING) {
+                    int j = solver->COLUMN[i] - colStart;
+                    row[j] = 1;
+                    support[(size_t) r * words + j / 64] |= (uint64_t) 1 << (j % 64);
+                }
+            }
+        }
+    }
+
+    // Single numbers first: the same answers the propagation backend gives
+    for (int r = 0; r < m; r++) {
+        boundRow(solver, board, &matrix[(size_t) r * (n + 1)], &support[(size_t) r * words], words, n, cols);
+    }
+
+    int rank = 0;
+    bool overflow = false;
+    for (int c = 0; c < n && rank < m && !overflow; c++) {
+        int pivot = rank;
+        while (pivot < m && matrix[(size_t) pivot * (n + 1) + c] == 0) {
+            pivot++;
+        }
+        if (pivot == m) {
+            continue;
+        }
+        for (int j = 0; j <= n && pivot != rank; j++) {
+            int64_t t = matrix[(size_t) pivot * (n + 1) + j];
+            matrix[(size_t) pivot * (n + 1) + j] = matrix[(size_t) rank * (n + 1) + j];
+            matrix[(size_t) rank * (n + 1) + j] = t;
+        }
+        for (int w = 0; w < words && pivot != rank; w++) {
+            uint64_t t = support[(size_t) pivot * words + w];
+            support[(size_t) pivot * words + w] = support[(size_t) rank * words + w];
+            support[(size_t) rank * words + w] = t;
+        }
+
+        const int64_t *pivotRow = &matrix[(size_t) rank * (n + 1)];
+        const uint64_t *pivotSupport = &support[(size_t) rank * words];
+        int64_t a = pivotRow[c];
+        for (int r = 0; r < m; r++) {
+            int64_t *row = &matrix[(size_t) r * (n + 1)];
+            int64_t b = row[c];
+            if (r == rank || b == 0) {
+                continue;
+            }
+            uint64_t *rowSupport = &support[(size_t) r * words];
+            int64_t divisor = 0;
+            for (int w = 0; w < words && !overflow; w++) {
+                uint64_t kept = 0;
+                for (uint64_t bits = rowSupport[w] | pivotSupport[w]; bits; bits &= bits - 1) {
+                    int j = w * 64 + __builtin_ctzll(bits);
+                    if (!combineTerms(a, row[j], b, pivotRow[j], &row[j])) {
+                        overflow = true;
+                        break;
+                    }
+                    if (row[j] != 0) {
+                        kept |= bits & -bits;
+                        divisor = gcd64(divisor, row[j]);
+                    }
+                }
+                rowSupport[w] = kept;
+            }
+            if (overflow || !combineTerms(a, row[n], b, pivotRow[n], &row[n])) {
+                overflow = true;
+                break;
+            }
+            divisor = gcd64(divisor, row[n]);
+            for (int w = 0; divisor > 1 && w < words; w++) {
+                for (uint64_t bits = rowSupport[w]; bits; bits &= bits - 1) {
+                    row[w * 64 + __builtin_ctzll(bits)] /= divisor;
+                }
+            }
+            if (divisor > 1) {
+                row[n] /= divisor;
+            }
+        }
+        rank++;
+    }
+
+    for (int r = 0; r < m && !overflow; r++) {
+        boundRow(solver, board, &matrix[(size_t) r * (n + 1)], &support[(size_t) r * words], words, n, cols);
+    }
+
+    free(matrix);
+    free(support);
+}
+
+// Each pass drains the queue, grows every queued number into its connected
+// frontier component (numbers linked through shared unknown cells) and
+// eliminates each component once. Deductions requeue numbers for the next pass.
+static void solveLinear(Solver *solver, TILE **board, Status status) {
+    int w = status.W_TILES, h = status.H_TILES, cells = w * h;
+    int *pending = solver->SYSTEM;
+    int *rows = solver->SYSTEM + cells;
+    int *cols = solver->SYSTEM + 2 * cells;
+
+    while (solver->QUEUE_COUNT > 0) {
+        int pendingCount = solver->QUEUE_COUNT;
+        for (int q = 0; q < pendingCount; q++) {
+            pending[q] = solver->QUEUE[q];
+            solver->QUEUED[pending[q]] = 0;
+        }
+        solver->QUEUE_COUNT = 0;
+
+        int rowCount = 0, colCount = 0;
+        for (int q = 0; q < pendingCount; q++) {
+            if (solver->COLUMN[pending[q]] != -1) {
+                continue;
+            }
+            int rowStart = rowCount, colStart = colCount;
+            solver->COLUMN[pending[q]] = -2;
+            rows[rowCount++] = pending[q];
+            for (int r = rowStart; r < rowCount; r++) {
+                int x = rows[r] / h, y = rows[r] % h;
+                for (int nx = x - 1; nx <= x + 1; nx++) {
+                    for (int ny = y - 1; ny <= y + 1; ny++) {
+                        int u = nx * h + ny;
+                        if (nx < 0 || nx >= w || ny < 0 || ny >= h || board[nx][ny].VISIBLE
+                            || solver->KNOWN[u] != KNOWN_NOTHING || solver->COLUMN[u] != -1) {
+                            continue;
+                        }
+                        solver->COLUMN[u] = colCount;
+                        cols[colCount++] = u;
+                        for (int vx = nx - 1; vx <= nx + 1; vx++) {
+                            for (int vy = ny - 1; vy <= ny + 1; vy++) {
+                                int v = vx * h + vy;
+                                if (vx >= 0 && vx < w && vy >= 0 && vy < h && board[vx][vy].VISIBLE
+                                    && board[vx][vy].TYPE == NUMBER && solver->COLUMN[v] == -1) {
+                                    solver->COLUMN[v] = -2;
+                                    rows[rowCount++] = v;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            int m = rowCount - rowStart, n = colCount - colStart;
+            if (n == 0) {
+                continue;
+            }
+            // The local rules first: reduced rows do not expose every pair
+            // difference, and they settle most components on their own
+            int before = solver->SAFE_COUNT + solver->MINE_COUNT;
+            for (int r = rowStart; r < rowCount; r++) {
+                examine(solver, board, status, rows[r]);
+            }
+            if (solver->SAFE_COUNT + solver->MINE_COUNT == before && (long) m * n <= LINEAR_MAX_ENTRIES) {
+                eliminate(solver, board, status, &rows[rowStart], m, &cols[colStart], n);
+            }
+        }
+
+        for (int r = 0; r < rowCount; r++) {
+            solver->COLUMN[rows[r]] = -1;
+        }
+        for (int c = 0; c < colCount; c++) {
+            solver->COLUMN[cols[c]] = -1;
+        }
+    }
+}
+
+int solverRun(Solver *solver, TILE **board, Status status) {
+    int found = solver->SAFE_COUNT + solver->MINE_COUNT;
+
+    if (solver->BACKEND == SOLVER_LINEAR) {
+        solveLinear(solver, board, status);
+    } else {
+        while (solver->QUEUE_COUNT > 0) {
+            int i = solver->QUEUE[--solver->QUEUE_COUNT];
+            solver->QUEUED[i] = 0;
+            examine(solver, board, status, i);
+        }
+    }
+
+    return solver->SAFE_COUNT + solver->MINE_COUNT - found;
+}
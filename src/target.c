@@ -0,0 +1,295 @@
+#include "target.h"
+#include <stdlib.h>
+#include <string.h>
+#include "noguess.h"
+
+void targetInit(TargetSearch *search, Status status) {
+    int cells = status.W_TILES * status.H_TILES;
+    search->MIN_BBBV = 0;
+    search->MAX_BBBV = cells;
+    search->NO_GUESS = false;
+    search->MAX_STEPS = 100000;
+    search->W_TILES = status.W_TILES;
+    search->H_TILES = status.H_TILES;
+    search->REGION = malloc(cells * sizeof(int));
+    search->MINES = malloc(cells * sizeof(int));
+    search->SLOT = malloc(cells * sizeof(int));
+    search->STAMP = calloc(cells, sizeof(unsigned int));
+    search->STAMP_ID = 0;
+    search->WINDOW = malloc(50 * sizeof(int));
+    search->STACK = malloc(cells * sizeof(int));
+    search->CELLS = malloc(cells * sizeof(int));
+    solverInit(&search->SOLVER, status);
+    search->WORK = (FloodWork) {0};
+    search->WORK.RECORD = true;
+}
+
+void targetFree(TargetSearch *search) {
+    free(search->REGION);
+    free(search->MINES);
+    free(search->SLOT);
+    free(search->STAMP);
+    free(search->WINDOW);
+    free(search->STACK);
+    free(search->CELLS);
+    solverFree(&search->SOLVER);
+    freeFloodWork(&search->WORK);
+}
+
+// Move the mine at from onto the safe cell to, numbers included
+static void moveMine(TargetSearch *search, TILE **board, Status status, int from, int to) {
+    int h = status.H_TILES;
+    removeMine(board, from / h, from % h, status);
+    addMine(board, to / h, to % h, status);
+    search->MINES[search->SLOT[from]] = to;
+    search->SLOT[to] = search->SLOT[from];
+    search->SLOT[from] = -1;
+}
+
+static bool isolatedAt(TILE **board, int w, int h, int x, int y) {
+    if (board[x][y].TYPE != NUMBER) {
+        return false;
+    }
+    for (int nx = x - 1; nx <= x + 1; nx++) {
+        for (int ny = y - 1; ny <= y + 1; ny++) {
+            if (nx >= 0 && nx < w && ny >= 0 && ny < h && board[nx][ny].TYPE == BLANK_TILE) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Give the blank region around cell a fresh label
+static void labelOpening(TargetSearch *search, TILE **board, int cell) {
+    int w = search->W_TILES, h = search->H_TILES, label = search->LABELS++, top = 0;
+    search->REGION[cell] = label;
+    search->STACK[top++] = cell;
+    while (top > 0) {
+        int i = search->STACK[--top];
+        int x = i / h, y = i % h;
+        for (int nx = x - 1; nx <= x + 1; nx++) {
+            for (int ny = y - 1; ny <= y + 1; ny++) {
+                int n = nx * h + ny;
+                if (nx >= 0 && nx < w && ny >= 0 && ny < h && board[nx][ny].TYPE == BLANK_TILE
+                    && search->REGION[n] != label) {
+                    search->REGION[n] = label;
+                    search->STACK[top++] = n;
+                }
+            }
+        }
+    }
+}
+
+// Label every opening and count the isolated numbers from scratch
+static void measureBoard(TargetSearch *search, TILE **board) {
+    int w = search->W_TILES, h = search->H_TILES;
+    search->LABELS = 0;
+    search->OPENINGS = 0;
+    search->ISOLATED = 0;
+    search->MINE_COUNT = 0;
+    for (int i = 0; i < w * h; i++) {
+        search->REGION[i] = -1;
+    }
+    for (int x = 0; x < w; x++) {
+        for (int y = 0; y < h; y++) {
+            int i = x * h + y;
+            search->SLOT[i] = -1;
+            if (board[x][y].TYPE == MINE) {
+                search->SLOT[i] = search->MINE_COUNT;
+                search->MINES[search->MINE_COUNT++] = i;
+            } else if (board[x][y].TYPE == BLANK_TILE && search->REGION[i] < 0) {
+                labelOpening(search, board, i);
+                search->OPENINGS += 1;
+            }
+            search->ISOLATED += isolatedAt(board, w, h, x, y);
+        }
+    }
+    search->BBBV = search->OPENINGS + search->ISOLATED;
+}
+
+// Cells within two of from or to: the only ones whose blank or isolated
+// state a move between them can change
+static int gatherWindow(TargetSearch *search, int from, int to) {
+    int w = search->W_TILES, h = search->H_TILES, count = 0;
+    unsigned int stamp = ++search->STAMP_ID;
+    if (stamp == 0) {
+        memset(search->STAMP, 0, w * h * sizeof(unsigned int));
+        stamp = search->STAMP_ID = 1;
+    }
+    int centres[2] = {from, to};
+    for (int c = 0; c < 2; c++) {
+        int cx = centres[c] / h, cy = centres[c] % h;
+        for (int x = cx - 2; x <= cx + 2; x++) {
+            for (int y = cy - 2; y <= cy + 2; y++) {
+                if (x >= 0 && x < w && y >= 0 && y < h && search->STAMP[x * h + y] != stamp) {
+                    search->STAMP[x * h + y] = stamp;
+                    search->WINDOW[count++] = x * h + y;
+                }
+            }
+        }
+    }
+    return count;
+}
+
+// Move a mine and bring OPENINGS, ISOLATED and BBBV up to date. An opening
+// that changes, merges or splits has a blank inside the window both before
+// and after the move, so the openings seen in the window beforehand are
+// dropped and the window's blanks are flooded again with fresh labels.
+static void moveAndMeasure(TargetSearch *search, TILE **board, Status status, int from, int to) {
+    int w = search->W_TILES, h = search->H_TILES;
+    int count = gatherWindow(search, from, to);
+    int labels[50], distinct = 0, isolated = 0;
+    for (int k = 0; k < count; k++) {
+        int i = search->WINDOW[k];
+        isolated -= isolatedAt(board, w, h, i / h, i % h);
+        int label = search->REGION[i];
+        if (label < 0) {
+            continue;
+        }
+        bool seen = false;
+        for (int l = 0; l < distinct && !seen; l++) {
+            seen = labels[l] == label;
+        }
+        if (!seen) {
+            labels[distinct++] = label;
+        }
+    }
+
+    moveMine(search, board, status, from, to);
+
+    int fresh = search->LABELS, floods = 0;
+    for (int k = 0; k < count; k++) {
+        int i = search->WINDOW[k];
+        isolated += isolatedAt(board, w, h, i / h, i % h);
+        if (board[i / h][i % h].TYPE != BLANK_TILE) {
+            search->REGION[i] = -1;
+        }
+    }
+    for (int k = 0; k < count; k++) {
+        int i = search->WINDOW[k];
+        if (board[i / h][i % h].TYPE == BLANK_TILE && search->REGION[i] < fresh) {
+            labelOpening(search, board, i);
+            floods += 1;
+        }
+    }
+    search->OPENINGS += floods - distinct;
+    search->ISOLATED += isolated;
+    search->BBBV = search->OPENINGS + search->ISOLATED;
+}
+
+static int bandDistance(const TargetSearch *search) {
+    if (search->BBBV < search->MIN_BBBV) return search->MIN_BBBV - search->BBBV;
+    if (search->BBBV > search->MAX_BBBV) return search->BBBV - search->MAX_BBBV;
+    return 0;
+}
+
+// Play from the click on whatever the solver proves safe. When it gets
+// stuck, pick the repair generateNoGuess would make: an undecided mine on
+// the frontier and a safe cell out of sight to move it to. The board is
+// hidden again either way.
+static bool solvableFrom(TargetSearch *search, TILE **board, Status status, int x, int y, int *from, int *to) {
+    Solver *solver = &search->SOLVER;
+    FloodWork *work = &search->WORK;
+    int w = status.W_TILES, h = status.H_TILES;
+    status.STATE = PLAYING;
+    status.VISIBLE_TILES = 0;
+    solverReset(solver);
+    work->CHANGE_COUNT = 0;
+    revealEmptyCells(board, x, y, &status, work);
+    solverUpdate(solver, board, status, work);
+    while (status.STATE == PLAYING) {
+        solverRun(solver, board, status);
+        if (solver->SAFE_COUNT == 0) {
+            break;
+        }
+        work->CHANGE_COUNT = 0;
+        for (int i = 0; i < solver->SAFE_COUNT; i++) {
+            revealEmptyCells(board, solver->SAFE[i] / h, solver->SAFE[i] % h, &status, work);
+        }
+        solver->SAFE_COUNT = 0;
+        solverUpdate(solver, board, status, work);
+    }
+    search->CHECKS += 1;
+
+    int sources = 0, targets = 0;
+    for (int cx = 0; cx < w; cx++) {
+        for (int cy = 0; cy < h; cy++) {
+            int i = cx * h + cy;
+            if (status.STATE == WIN || board[cx][cy].VISIBLE || solver->KNOWN[i] != KNOWN_NOTHING) {
+                continue;
+            }
+            bool frontier = false;
+            for (int nx = cx - 1; nx <= cx + 1; nx++) {
+                for (int ny = cy - 1; ny <= cy + 1; ny++) {
+                    frontier |= nx >= 0 && nx < w && ny >= 0 && ny < h && board[nx][ny].VISIBLE;
+                }
+            }
+            if (frontier && board[cx][cy].TYPE == MINE) {
+                search->CELLS[sources++] = i;
+            } else if (!frontier && board[cx][cy].TYPE != MINE) {
+                search->STACK[targets++] = i;
+            }
+        }
+    }
+    for (int cx = 0; cx < w; cx++) {
+        for (int cy = 0; cy < h; cy++) {
+            board[cx][cy].VISIBLE = false;
+        }
+    }
+    *from = sources > 0 && targets > 0 ? search->CELLS[rngRange(&search->RNG, sources)] : -1;
+    *to = sources > 0 && targets > 0 ? search->STACK[rngRange(&search->RNG, targets)] : -1;
+    return status.STATE == WIN;
+}
+
+// A board whose 3BV lies in [MIN_BBBV, MAX_BBBV] with the click (x, y) on an
+// opening, or false after MAX_STEPS moves. Sideways moves are kept so the
+// search drifts across plateaus. With NO_GUESS, a board in the band that
+// the solver cannot finish takes the solver's repair move whatever it does
+// to 3BV, and the search goes on from there.
+bool generateTargeted(TILE **board, Status *status, int x, int y, Rng *rng, TargetSearch *search) {
+    int w = status->W_TILES, h = status->H_TILES;
+    search->STEPS = 0;
+    search->ACCEPTED = 0;
+    search->CHECKS = 0;
+    if (!placeMines(board, status, x, y, rng, search->CELLS)) {
+        return false;
+    }
+    measureBoard(search, board);
+    long maxSteps = search->MINE_COUNT > 0 ? search->MAX_STEPS : 0;
+    search->RNG = *rng;
+
+    for (;;) {
+        int distance = bandDistance(search), from = -1, to = -1;
+        if (distance == 0) {
+            if (!search->NO_GUESS || solvableFrom(search, board, *status, x, y, &from, &to)) {
+                status->VISIBLE_TILES = 0;
+                status->STATE = START;
+                *rng = search->RNG;
+                return true;
+            }
+        }
+        if (search->STEPS == maxSteps) {
+            *rng = search->RNG;
+            return false;
+        }
+        search->STEPS += 1;
+
+        if (from >= 0) {
+            moveAndMeasure(search, board, *status, from, to);
+            search->ACCEPTED += 1;
+            continue;
+        }
+        from = search->MINES[rngRange(&search->RNG, search->MINE_COUNT)];
+        to = rngRange(&search->RNG, w * h);
+        if (search->SLOT[to] >= 0 || (abs(to / h - x) <= 1 && abs(to % h - y) <= 1)) {
+            continue;
+        }
+        moveAndMeasure(search, board, *status, from, to);
+        if (bandDistance(search) > distance) {
+            moveAndMeasure(search, board, *status, to, from);
+        } else {
+            search->ACCEPTED += 1;
+        }
+    }
+}
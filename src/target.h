@@ -0,0 +1,48 @@
+#ifndef TARGET_H
+#define TARGET_H
+
+#include "game.h"
+#include "rng.h"
+#include "solver.h"
+
+// Local search for a board inside a 3BV band, optionally also solvable
+// without guessing from the first click. Starting from one random board, a
+// step moves a random mine to a random empty cell outside the click's 3x3
+// and keeps the move unless it leaves the board further from the band.
+// Numbers and 3BV are updated around the move only: the isolated numbers
+// are recounted in the 5x5 windows of both cells, and just the openings
+// that touch those windows are flooded again. Cells are indexed
+// x * H_TILES + y.
+typedef struct TargetSearch {
+    int MIN_BBBV;
+    int MAX_BBBV;
+    bool NO_GUESS;
+    long MAX_STEPS;
+    long STEPS;             // last search: moves tried
+    long ACCEPTED;          // moves kept
+    int CHECKS;             // solver runs for NO_GUESS
+    int BBBV;
+    int OPENINGS;
+    int ISOLATED;
+    int W_TILES;
+    int H_TILES;
+    int *REGION;            // opening label of each blank cell, -1 for any other
+    int LABELS;             // next unused label
+    int *MINES;             // dense list of mine cells
+    int MINE_COUNT;
+    int *SLOT;              // position in MINES, -1 for a safe cell
+    unsigned int *STAMP;    // window membership of the current step
+    unsigned int STAMP_ID;
+    int *WINDOW;
+    int *STACK;
+    int *CELLS;
+    Rng RNG;                // the caller's stream while a search runs
+    Solver SOLVER;
+    FloodWork WORK;
+} TargetSearch;
+
+void targetInit(TargetSearch *search, Status status);
+void targetFree(TargetSearch *search);
+bool generateTargeted(TILE **board, Status *status, int x, int y, Rng *rng, TargetSearch *search);
+
+#endif
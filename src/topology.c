@@ -0,0 +1,249 @@
+#include "topology.h"
+#include <stdlib.h>
+
+// Neighbour offsets (dx, dy) as lists of F(dx, dy), so a kernel expands to
+// one statement per neighbour with constant offsets
+#define SQUARE_OFFSETS(F) F(-1, -1) F(-1, 0) F(-1, 1) F(0, -1) F(0, 1) F(1, -1) F(1, 0) F(1, 1)
+#define HEX_EVEN_OFFSETS(F) F(0, -1) F(0, 1) F(-1, -1) F(-1, 0) F(1, -1) F(1, 0)
+#define HEX_ODD_OFFSETS(F) F(0, -1) F(0, 1) F(-1, 0) F(-1, 1) F(1, 0) F(1, 1)
+
+#define OFFSET(dx, dy) {dx, dy},
+
+static const int squareOffsets[8][2] = {SQUARE_OFFSETS(OFFSET)};
+static const int hexOffsets[2][6][2] = {{HEX_EVEN_OFFSETS(OFFSET)}, {HEX_ODD_OFFSETS(OFFSET)}};
+
+int topologyNeighbours(Topology topology, int x, int y, int width, int height, int *cells) {
+    int count = 0;
+    if (topology == TOPOLOGY_TORUS) {
+        for (int d = 0; d < 8; d++) {
+            int nx = (x + squareOffsets[d][0] + width) % width;
+            int ny = (y + squareOffsets[d][1] + height) % height;
+            cells[count++] = nx * height + ny;
+        }
+        return count;
+    }
+
+    const int (*offsets)[2] = topology == TOPOLOGY_HEX ? hexOffsets[x & 1] : squareOffsets;
+    int neighbours = topology == TOPOLOGY_HEX ? 6 : 8;
+    for (int d = 0; d < neighbours; d++) {
+        int nx = x + offsets[d][0];
+        int ny = y + offsets[d][1];
+        if (nx >= 0 && nx < width && ny >= 0 && ny < height) {
+            cells[count++] = nx * height + ny;
+        }
+    }
+    return count;
+}
+
+// Numbers one cell the plain way and tells whether it is a mine
+static int numberCell(Topology topology, TILE **board, int x, int y, int width, int height) {
+    if (board[x][y].TYPE == MINE) {
+        return 1;
+    }
+    int cells[TOPOLOGY_MAX_NEIGHBOURS];
+    int count = topologyNeighbours(topology, x, y, width, height, cells);
+    int amount = 0;
+    for (int i = 0; i < count; i++) {
+        amount += board[cells[i] / height][cells[i] % height].TYPE == MINE;
+    }
+    board[x][y].AMOUNT = amount;
+    board[x][y].TYPE = amount ? NUMBER : BLANK_TILE;
+    return 0;
+}
+
+// Numbers the first and last row of column x and returns how many of those
+// two cells are mines
+static int numberEnds(Topology topology, TILE **board, int x, int width, int height) {
+    int mines = 0;
+    for (int y = 0; y < height; y += height > 1 ? height - 1 : 1) {
+        mines += numberCell(topology, board, x, y, width, height);
+    }
+    return mines;
+}
+
+// Numbers the first and last column, which have a side the clipped fills
+// do not, and returns how many mines they hold
+static int numberSides(Topology topology, TILE **board, int width, int height) {
+    int mines = 0;
+    for (int x = 0; x < width; x += width > 1 ? width - 1 : 1) {
+        for (int y = 0; y < height; y++) {
+            mines += numberCell(topology, board, x, y, width, height);
+        }
+    }
+    return mines;
+}
+
+// Rows 1 to h - 2 of columns[1], with columns[0] and columns[2] the columns
+// on either side
+#define MINE_AT(dx, dy) + (columns[1 + (dx)][y + (dy)].TYPE == MINE)
+#define NUMBER_ROWS(OFFSETS)                                        \
+    for (int y = 1; y < h - 1; y++) {                               \
+        if (columns[1][y].TYPE == MINE) {                           \
+            bombs += 1;                                             \
+            continue;                                               \
+        }                                                           \
+        int amount = 0 OFFSETS(MINE_AT);                            \
+        columns[1][y].AMOUNT = amount;                              \
+        columns[1][y].TYPE = amount ? NUMBER : BLANK_TILE;          \
+    }
+
+static int squareNumbers(TILE **board, int w, int h) {
+    int bombs = numberSides(TOPOLOGY_SQUARE, board, w, h);
+    for (int x = 1; x < w - 1; x++) {
+        TILE *columns[3] = {board[x - 1], board[x], board[x + 1]};
+        NUMBER_ROWS(SQUARE_OFFSETS)
+        bombs += numberEnds(TOPOLOGY_SQUARE, board, x, w, h);
+    }
+    return bombs;
+}
+
+static int torusNumbers(TILE **board, int w, int h) {
+    int bombs = 0;
+    for (int x = 0; x < w; x++) {
+        TILE *columns[3] = {board[x > 0 ? x - 1 : w - 1], board[x], board[x < w - 1 ? x + 1 : 0]};
+        NUMBER_ROWS(SQUARE_OFFSETS)
+        bombs += numberEnds(TOPOLOGY_TORUS, board, x, w, h);
+    }
+    return bombs;
+}
+
+static int hexNumbers(TILE **board, int w, int h) {
+    int bombs = numberSides(TOPOLOGY_HEX, board, w, h);
+    for (int x = 1; x < w - 1; x++) {
+        TILE *columns[3] = {board[x - 1], board[x], board[x + 1]};
+        if (x & 1) {
+            NUMBER_ROWS(HEX_ODD_OFFSETS)
+        } else {
+            NUMBER_ROWS(HEX_EVEN_OFFSETS)
+        }
+        bombs += numberEnds(TOPOLOGY_HEX, board, x, w, h);
+    }
+    return bombs;
+}
+
+void topologyNumbers(Topology topology, TILE **board, Status *status) {
+    int w = status->W_TILES, h = status->H_TILES;
+    if (topology == TOPOLOGY_TORUS) {
+        status->BOMBS = torusNumbers(board, w, h);
+    } else if (topology == TOPOLOGY_HEX) {
+        status->BOMBS = hexNumbers(board, w, h);
+    } else {
+        status->BOMBS = squareNumbers(board, w, h);
+    }
+}
+
+static void reserve(FloodWork *work, int more) {
+    if (work->COUNT + more > work->CAPACITY) {
+        while (work->COUNT + more > work->CAPACITY) {
+            work->CAPACITY = work->CAPACITY ? work->CAPACITY * 2 : 64;
+        }
+        work->STACK = realloc(work->STACK, work->CAPACITY * 2 * sizeof(int));
+    }
+}
+
+// Opens one popped cell the way drainFlood does and tells whether the fill
+// goes on to its neighbours
+static bool openCell(TILE **board, int x, int y, Status *status, FloodWork *work) {
+    TILE *tile = &board[x][y];
+    if (tile->VISIBLE || tile->MARK == CELL_FLAGGED) {
+        return false;
+    }
+    recordCellChange(work, x * status->H_TILES + y, tile);
+    tile->VISIBLE = true;
+    status->VISIBLE_TILES += 1;
+
+    if (tile->TYPE == MINE) {
+        tile->TYPE = MINE_EXPLOSION;
+        status->STATE = LOSE;
+        return false;
+    }
+    if (status->STATE != LOSE && (status->VISIBLE_TILES + status->BOMBS) == (status->W_TILES * status->H_TILES)) {
+        status->STATE = WIN;
+    }
+    return tile->TYPE != NUMBER;
+}
+
+// Room for every push must be reserved first
+#define PUSH(nx, ny)                                                        \
+    if (!board[nx][ny].VISIBLE && board[nx][ny].MARK != CELL_FLAGGED) {     \
+        work->STACK[work->COUNT * 2] = (nx);                                \
+        work->STACK[work->COUNT * 2 + 1] = (ny);                            \
+        work->COUNT += 1;                                                   \
+    }
+#define PUSH_AT(dx, dy) PUSH(x + (dx), y + (dy))
+#define PUSH_WRAPPED(dx, dy) PUSH(xs[1 + (dx)], ys[1 + (dy)])
+
+static void pushNeighbours(Topology topology, TILE **board, int x, int y, Status *status, FloodWork *work) {
+    int cells[TOPOLOGY_MAX_NEIGHBOURS];
+    int count = topologyNeighbours(topology, x, y, status->W_TILES, status->H_TILES, cells);
+    for (int i = 0; i < count; i++) {
+        int nx = cells[i] / status->H_TILES, ny = cells[i] % status->H_TILES;
+        PUSH(nx, ny)
+    }
+}
+
+// Pops the next cell into x and y, skipping any that does not spread
+#define NEXT_OPEN_CELL()                                                    \
+    work->COUNT -= 1;                                                       \
+    int x = work->STACK[work->COUNT * 2];                                   \
+    int y = work->STACK[work->COUNT * 2 + 1];                               \
+    if (!openCell(board, x, y, status, work)) {                             \
+        continue;                                                           \
+    }                                                                       \
+    reserve(work, TOPOLOGY_MAX_NEIGHBOURS)
+
+static void squareDrain(TILE **board, Status *status, FloodWork *work) {
+    int w = status->W_TILES, h = status->H_TILES;
+    while (work->COUNT > 0) {
+        NEXT_OPEN_CELL();
+        if (x > 0 && x < w - 1 && y > 0 && y < h - 1) {
+            SQUARE_OFFSETS(PUSH_AT)
+        } else {
+            pushNeighbours(TOPOLOGY_SQUARE, board, x, y, status, work);
+        }
+    }
+}
+
+static void torusDrain(TILE **board, Status *status, FloodWork *work) {
+    int w = status->W_TILES, h = status->H_TILES;
+    while (work->COUNT > 0) {
+        NEXT_OPEN_CELL();
+        int xs[3] = {x > 0 ? x - 1 : w - 1, x, x < w - 1 ? x + 1 : 0};
+        int ys[3] = {y > 0 ? y - 1 : h - 1, y, y < h - 1 ? y + 1 : 0};
+        SQUARE_OFFSETS(PUSH_WRAPPED)
+    }
+}
+
+static void hexDrain(TILE **board, Status *status, FloodWork *work) {
+    int w = status->W_TILES, h = status->H_TILES;
+    while (work->COUNT > 0) {
+        NEXT_OPEN_CELL();
+        if (x > 0 && x < w - 1 && y > 0 && y < h - 1) {
+            if (x & 1) {
+                HEX_ODD_OFFSETS(PUSH_AT)
+            } else {
+                HEX_EVEN_OFFSETS(PUSH_AT)
+            }
+        } else {
+            pushNeighbours(TOPOLOGY_HEX, board, x, y, status, work);
+        }
+    }
+}
+
+void topologyReveal(Topology topology, TILE **board, int x, int y, Status *status, FloodWork *work) {
+    if (x < 0 || x >= status->W_TILES || y < 0 || y >= status->H_TILES) {
+        return;
+    }
+    reserve(work, 1);
+    work->STACK[work->COUNT * 2] = x;
+    work->STACK[work->COUNT * 2 + 1] = y;
+    work->COUNT += 1;
+
+    if (topology == TOPOLOGY_TORUS) {
+        torusDrain(board, status, work);
+    } else if (topology == TOPOLOGY_HEX) {
+        hexDrain(board, status, work);
+    } else {
+        squareDrain(board, status, work);
+    }
+}
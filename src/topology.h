@@ -0,0 +1,39 @@
+#ifndef TOPOLOGY_H
+#define TOPOLOGY_H
+
+#include "game.h"
+
+// Neighbourhoods other than the clipped square grid. TOPOLOGY_TORUS wraps
+// both axes and needs at least 3 columns and rows, so no cell is its own
+// neighbour twice over. TOPOLOGY_HEX keeps board[x][y] but reads columns as
+// hexagons with odd columns half a cell lower: a cell touches the two
+// cells above and below it, and in each side column the cells at rows
+// y - 1 and y for an even x, y and y + 1 for an odd x.
+typedef enum Topology {
+    TOPOLOGY_SQUARE,
+    TOPOLOGY_TORUS,
+    TOPOLOGY_HEX,
+    TOPOLOGIES
+} Topology;
+
+#define TOPOLOGY_MAX_NEIGHBOURS 8
+
+// The kernels are compiled once per topology with the neighbour offsets
+// spelled out, and the topology is picked once per call. No neighbour goes
+// through a direction table, a modulo or a bounds check, except in the first
+// and last rows and, for the square and hex fills, columns; those take
+// topologyNeighbours, the plain version for code off the hot paths.
+// topologyNumbers sets every AMOUNT and TYPE from the mines and counts
+// status->BOMBS. topologyReveal opens like revealEmptyCells and records
+// changes the same way, but leaves work->FRONTIER alone, since a Frontier
+// follows square neighbours.
+//
+// Only the square kernel is part of the game: generateNumbers is
+// topologyNumbers with TOPOLOGY_SQUARE, and the solver, frontier,
+// probabilities, mine moves and drawing all assume square neighbours. The
+// torus and hex kernels are there for tools and bench until those follow.
+int topologyNeighbours(Topology topology, int x, int y, int width, int height, int *cells);
+void topologyNumbers(Topology topology, TILE **board, Status *status);
+void topologyReveal(Topology topology, TILE **board, int x, int y, Status *status, FloodWork *work);
+
+#endif
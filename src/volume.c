@@ -0,0 +1,257 @@
+#include "volume.h"
+#include <stdlib.h>
+#include <string.h>
+
+void volumeInit(Volume *volume, int width, int height, int depth) {
+    volume->W_TILES = width;
+    volume->H_TILES = height;
+    volume->D_TILES = depth;
+    volume->BOMBS = 0;
+    volume->VISIBLE_TILES = 0;
+    volume->STATE = START;
+    volume->EXPLODED = -1;
+    volume->STRIDE_Y = depth + 2;
+    volume->STRIDE_X = (height + 2) * volume->STRIDE_Y;
+    volume->SIZE = (width + 2) * volume->STRIDE_X;
+    volume->CELLS = malloc(volume->SIZE);
+    volume->STACK = NULL;
+    volume->PENDING = 0;
+    volume->CAPACITY = 0;
+    volume->PLANES = malloc(4 * (size_t) volume->STRIDE_X);
+
+    int n = 0;
+    for (int dx = -1; dx <= 1; dx++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dz = -1; dz <= 1; dz++) {
+                if (dx || dy || dz) {
+                    volume->NEIGHBOURS[n++] = dx * volume->STRIDE_X + dy * volume->STRIDE_Y + dz;
+                }
+            }
+        }
+    }
+}
+
+void volumeFree(Volume *volume) {
+    free(volume->CELLS);
+    free(volume->STACK);
+    free(volume->PLANES);
+}
+
+// Empty board with the border marked visible
+void volumeClear(Volume *volume) {
+    memset(volume->CELLS, 0, volume->SIZE);
+    for (int x = 0; x < volume->W_TILES + 2; x++) {
+        uint8_t *plane = &volume->CELLS[x * volume->STRIDE_X];
+        if (x == 0 || x == volume->W_TILES + 1) {
+            memset(plane, VOLUME_VISIBLE, volume->STRIDE_X);
+            continue;
+        }
+        memset(plane, VOLUME_VISIBLE, volume->STRIDE_Y);
+        memset(plane + volume->STRIDE_X - volume->STRIDE_Y, VOLUME_VISIBLE, volume->STRIDE_Y);
+        for (int y = 1; y <= volume->H_TILES; y++) {
+            plane[y * volume->STRIDE_Y] = VOLUME_VISIBLE;
+            plane[y * volume->STRIDE_Y + volume->D_TILES + 1] = VOLUME_VISIBLE;
+        }
+    }
+    volume->BOMBS = 0;
+    volume->VISIBLE_TILES = 0;
+    volume->STATE = START;
+    volume->EXPLODED = -1;
+    volume->PENDING = 0;
+}
+
+// Exactly `bombs` distinct mines, none in the 3x3x3 around the first click,
+// then numbered. A draw is one index into the padded board, redrawn if it
+// lands on the border, the click's box (flagged while placing) or a mine,
+// so keep the board under half full. False when the mines do not fit.
+bool volumeGenerate(Volume *volume, int bombs, int x, int y, int z, Rng *rng) {
+    volumeClear(volume);
+    long room = (long) volume->W_TILES * volume->H_TILES * volume->D_TILES;
+    for (int i = 0; i < 27; i++) {
+        int nx = x + i / 9 - 1, ny = y + i / 3 % 3 - 1, nz = z + i % 3 - 1;
+        if (nx >= 0 && nx < volume->W_TILES && ny >= 0 && ny < volume->H_TILES && nz >= 0 && nz < volume->D_TILES) {
+            volume->CELLS[volumeIndex(volume, nx, ny, nz)] = VOLUME_FLAGGED;
+            room -= 1;
+        }
+    }
+    if (bombs > room) {
+        return false;
+    }
+
+    uint8_t *cells = volume->CELLS;
+    for (int placed = 0; placed < bombs;) {
+        int i = rngRange(rng, volume->SIZE);
+        if (!cells[i]) {
+            cells[i] = VOLUME_MINE;
+            placed += 1;
+        }
+    }
+    for (int i = 0; i < 27; i++) {
+        int nx = x + i / 9 - 1, ny = y + i / 3 % 3 - 1, nz = z + i % 3 - 1;
+        if (nx >= 0 && nx < volume->W_TILES && ny >= 0 && ny < volume->H_TILES && nz >= 0 && nz < volume->D_TILES) {
+            volume->CELLS[volumeIndex(volume, nx, ny, nz)] = 0;
+        }
+    }
+    volume->BOMBS = bombs;
+    volumeNumbers(volume);
+    return true;
+}
+
+#define BYTES(b) (0x0101010101010101ULL * (b))
+
+static inline uint64_t load8(const uint8_t *p) {
+    uint64_t word;
+    memcpy(&word, p, sizeof(word));
+    return word;
+}
+
+static inline void store8(uint8_t *p, uint64_t word) {
+    memcpy(p, &word, sizeof(word));
+}
+
+// 3x3 sums over y and z of the mines in one x plane: first along z, which
+// is contiguous, then along y. Each pass is a flat loop over the plane, 8
+// cells to a word since no sum can carry into the next byte; the border
+// stops a row's sums from picking up the next row.
+static void planeSums(const uint8_t *plane, int size, int strideY, uint8_t *rows, uint8_t *sums) {
+    int i = 1;
+    rows[0] = rows[size - 1] = 0;
+    for (; i + 9 <= size; i += 8) {
+        store8(rows + i, (load8(plane + i - 1) & BYTES(VOLUME_MINE)) + (load8(plane + i) & BYTES(VOLUME_MINE))
+                         + (load8(plane + i + 1) & BYTES(VOLUME_MINE)));
+    }
+    for (; i < size - 1; i++) {
+        rows[i] = (plane[i - 1] & VOLUME_MINE) + (plane[i] & VOLUME_MINE) + (plane[i + 1] & VOLUME_MINE);
+    }
+    for (i = strideY; i + 8 <= size - strideY; i += 8) {
+        store8(sums + i, load8(rows + i - strideY) + load8(rows + i) + load8(rows + i + strideY));
+    }
+    for (; i < size - strideY; i++) {
+        sums[i] = rows[i - strideY] + rows[i] + rows[i + strideY];
+    }
+}
+
+// Neighbour counts as separable 3x3x3 box sums. The x planes stream
+// through a ring of three plane sums, so the board is read and written
+// about once and the working set stays at four planes.
+void volumeNumbers(Volume *volume) {
+    int size = volume->STRIDE_X, strideY = volume->STRIDE_Y;
+    uint8_t *rows = volume->PLANES;
+    uint8_t *prev = rows + size, *cur = prev + size, *next = cur + size;
+    memset(prev, 0, size);
+    memset(cur, 0, size);
+    memset(next, 0, size);
+    planeSums(&volume->CELLS[size], size, strideY, rows, cur);
+
+    const uint64_t flags = BYTES(VOLUME_MINE | VOLUME_VISIBLE | VOLUME_FLAGGED);
+    for (int x = 1; x <= volume->W_TILES; x++) {
+        uint8_t *plane = &volume->CELLS[x * size];
+        if (x < volume->W_TILES) {
+            planeSums(plane + size, size, strideY, rows, next);
+        } else {
+            memset(next, 0, size);
+        }
+        // A mine counts itself, so the subtraction never borrows
+        int i = strideY;
+        for (; i + 8 <= size - strideY; i += 8) {
+            uint64_t cells = load8(plane + i);
+            uint64_t count = load8(prev + i) + load8(cur + i) + load8(next + i) - (cells & BYTES(VOLUME_MINE));
+            store8(plane + i, (cells & flags) | count << VOLUME_COUNT_SHIFT);
+        }
+        for (; i < size - strideY; i++) {
+            int count = prev[i] + cur[i] + next[i] - (plane[i] & VOLUME_MINE);
+            plane[i] = (plane[i] & (VOLUME_MINE | VOLUME_VISIBLE | VOLUME_FLAGGED)) | count << VOLUME_COUNT_SHIFT;
+        }
+        uint8_t *spare = prev;
+        prev = cur;
+        cur = next;
+        next = spare;
+    }
+}
+
+static void checkWin(Volume *volume) {
+    if (volume->VISIBLE_TILES + volume->BOMBS == (long) volume->W_TILES * volume->H_TILES * volume->D_TILES) {
+        volume->STATE = WIN;
+    }
+}
+
+// Opens one cell. A zero cell only goes on the stack, and volumeSpread
+// opens the rest of its region, so a reveal that opens millions of cells
+// can be shared out over frames; the region is drawn as it grows. Another
+// reveal may come in while one is still spreading.
+void volumeReveal(Volume *volume, int x, int y, int z) {
+    if (x < 0 || x >= volume->W_TILES || y < 0 || y >= volume->H_TILES || z < 0 || z >= volume->D_TILES
+        || volume->STATE == WIN || volume->STATE == LOSE) {
+        return;
+    }
+    uint8_t *cells = volume->CELLS;
+    int start = volumeIndex(volume, x, y, z);
+    if (cells[start] & (VOLUME_VISIBLE | VOLUME_FLAGGED)) {
+        return;
+    }
+    cells[start] |= VOLUME_VISIBLE;
+    volume->VISIBLE_TILES += 1;
+    volume->STATE = PLAYING;
+    if (cells[start] & VOLUME_MINE) {
+        volume->STATE = LOSE;
+        volume->EXPLODED = start;
+        return;
+    }
+
+    if (cells[start] >> VOLUME_COUNT_SHIFT == 0) {
+        if (volume->PENDING + 1 > volume->CAPACITY) {
+            volume->CAPACITY = volume->CAPACITY ? volume->CAPACITY * 2 : 1024;
+            volume->STACK = realloc(volume->STACK, volume->CAPACITY * sizeof(int));
+        }
+        volume->STACK[volume->PENDING++] = start;
+    }
+    if (volume->PENDING == 0) {
+        checkWin(volume);
+    }
+}
+
+// Spreads the pending reveals through at most budget zero cells, like
+// revealEmptyCells, and tells whether none are left. A cell is opened as it
+// is found rather than when it is popped, so the stack only holds zero
+// cells, each once. No neighbour of a zero cell is a mine.
+bool volumeSpread(Volume *volume, long budget) {
+    uint8_t *cells = volume->CELLS;
+    int count = volume->PENDING;
+    long opened = 0;
+    while (count > 0 && budget-- > 0) {
+        if (count + 26 > volume->CAPACITY) {
+            volume->CAPACITY *= 2;
+            volume->STACK = realloc(volume->STACK, volume->CAPACITY * sizeof(int));
+        }
+        int *stack = volume->STACK;
+        int cell = stack[--count];
+        for (int k = 0; k < 26; k++) {
+            int next = cell + volume->NEIGHBOURS[k];
+            uint8_t value = cells[next];
+            if (!(value & (VOLUME_VISIBLE | VOLUME_FLAGGED))) {
+                cells[next] = value | VOLUME_VISIBLE;
+                opened += 1;
+                if (value >> VOLUME_COUNT_SHIFT == 0) {
+                    stack[count++] = next;
+                }
+            }
+        }
+    }
+    volume->PENDING = count;
+    volume->VISIBLE_TILES += opened;
+    if (count == 0 && volume->STATE == PLAYING) {
+        checkWin(volume);
+    }
+    return count == 0;
+}
+
+void volumeFlag(Volume *volume, int x, int y, int z) {
+    if (x < 0 || x >= volume->W_TILES || y < 0 || y >= volume->H_TILES || z < 0 || z >= volume->D_TILES
+        || volume->STATE == WIN || volume->STATE == LOSE) {
+        return;
+    }
+    int index = volumeIndex(volume, x, y, z);
+    if (!(volume->CELLS[index] & VOLUME_VISIBLE)) {
+        volume->CELLS[index] ^= VOLUME_FLAGGED;
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef VOLUME_H
+#define VOLUME_H
+
+#include <stdint.h>
+#include "game.h"
+#include "rng.h"
+
+#define VOLUME_MINE 1
+#define VOLUME_VISIBLE 2
+#define VOLUME_FLAGGED 4
+#define VOLUME_COUNT_SHIFT 3        // mines among the 26 neighbours, up to 26
+#define VOLUME_FRAME_BUDGET 32768   // zero cells the game spreads per frame
+
+// W_TILES x H_TILES x D_TILES board, one byte per cell: the flags above and
+// the neighbour count in the top five bits. A one cell border of visible
+// empty cells surrounds it, so neither numbering nor the flood fill ever
+// checks bounds and a neighbour is a fixed offset from its cell, so the
+// padded size must fit an int. z is the contiguous axis; cell (x, y, z) is
+// at volumeIndex. Counts on the border mean nothing.
+typedef struct Volume {
+    int W_TILES;
+    int H_TILES;
+    int D_TILES;
+    int BOMBS;
+    long VISIBLE_TILES;
+    State STATE;
+    int EXPLODED;               // index of the mine that ended the game, or -1
+    int STRIDE_X;               // (H_TILES + 2) * (D_TILES + 2)
+    int STRIDE_Y;               // D_TILES + 2
+    int SIZE;
+    uint8_t *CELLS;
+    int NEIGHBOURS[26];         // index offsets
+    int *STACK;                 // zero cells opened but not spread yet
+    int PENDING;
+    int CAPACITY;
+    uint8_t *PLANES;            // four STRIDE_X planes of numbering scratch
+} Volume;
+
+static inline int volumeIndex(const Volume *volume, int x, int y, int z) {
+    return (x + 1) * volume->STRIDE_X + (y + 1) * volume->STRIDE_Y + z + 1;
+}
+
+static inline int volumeCount(const Volume *volume, int index) {
+    return volume->CELLS[index] >> VOLUME_COUNT_SHIFT;
+}
+
+void volumeInit(Volume *volume, int width, int height, int depth);
+void volumeFree(Volume *volume);
+void volumeClear(Volume *volume);
+bool volumeGenerate(Volume *volume, int bombs, int x, int y, int z, Rng *rng);
+void volumeNumbers(Volume *volume);
+void volumeReveal(Volume *volume, int x, int y, int z);
+bool volumeSpread(Volume *volume, long budget);
+void volumeFlag(Volume *volume, int x, int y, int z);
+
+#endif
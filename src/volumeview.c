@@ -0,0 +1,45 @@
+#include "volumeview.h"
+#include <stdio.h>
+
+// Draws the columns x rows window of layer z whose top left cell is (left,
+// top), tile pixels a cell from origin, with the sprites of the 2D board.
+// Counts above 8 have no sprite and are written over a blank tile. Only the
+// window is read, so a 256x256 layer costs no more than the visible part.
+void drawVolumeLayer(const Volume *volume, int z, int left, int top, int columns, int rows, Vector2 origin,
+                     int tile, const Texture *sprites) {
+    bool over = volume->STATE == WIN || volume->STATE == LOSE;
+    char label[12];
+    for (int x = left; x < left + columns && x < volume->W_TILES; x++) {
+        for (int y = top; y < top + rows && y < volume->H_TILES; y++) {
+            Vector2 rect = {origin.x + (x - left) * tile, origin.y + (y - top) * tile};
+            int index = volumeIndex(volume, x, y, z);
+            uint8_t cell = volume->CELLS[index];
+
+            if (!(cell & VOLUME_VISIBLE) && !over) {
+                DrawTextureV(sprites[9], rect, WHITE);
+                if (cell & VOLUME_FLAGGED) {
+                    DrawTextureV(sprites[10], rect, WHITE);
+                }
+                continue;
+            }
+
+            if (cell & VOLUME_MINE) {
+                DrawTextureV(sprites[index == volume->EXPLODED ? 15 : 14], rect, WHITE);
+                continue;
+            }
+            int count = volumeCount(volume, index);
+            if (count == 0 || count > 8) {
+                DrawTextureV(sprites[8], rect, WHITE);
+            } else {
+                DrawTextureV(sprites[count - 1], rect, WHITE);
+            }
+            if (count > 8) {
+                snprintf(label, sizeof(label), "%d", count);
+                DrawText(label, rect.x + tile / 4, rect.y + tile / 4, tile / 2, DARKGRAY);
+            }
+            if ((cell & VOLUME_FLAGGED) && volume->STATE == LOSE) {
+                DrawTextureV(sprites[11], rect, WHITE);
+            }
+        }
+    }
+}
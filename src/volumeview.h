@@ -0,0 +1,10 @@
+#ifndef VOLUMEVIEW_H
+#define VOLUMEVIEW_H
+
+#include "raylib.h"
+#include "volume.h"
+
+void drawVolumeLayer(const Volume *volume, int z, int left, int top, int columns, int rows, Vector2 origin,
+                     int tile, const Texture *sprites);
+
+#endif
@@ -0,0 +1,1893 @@
+// Headless micro-benchmarks for the game core. Does not link raylib:
+//
+//     cc -O2 -Isrc tools/bench.c src/game.c src/bitmap.c src/openings.c src/history.c src/save.c src/solver.c src/noguess.c src/probability.c src/frontier.c src/hint.c src/bot.c src/executor.c src/sliced.c src/metrics.c src/target.c src/density.c src/topology.c src/volume.c -pthread -lm -o bench
+//     ./bench [section...]
+//
+// With no arguments every section runs.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "game.h"
+#include "bitmap.h"
+#include "openings.h"
+#include "history.h"
+#include "save.h"
+#include "solver.h"
+#include "noguess.h"
+#include "probability.h"
+#include "frontier.h"
+#include "hint.h"
+#include "bot.h"
+#include "executor.h"
+#include "sliced.h"
+#include "metrics.h"
+#include "target.h"
+#include "density.h"
+#include "topology.h"
+#include "volume.h"
+#include "rng.h"
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static unsigned long long benchState = 0x9E3779B97F4A7C15ULL;
+
+static unsigned int benchRand(void) {
+    benchState ^= benchState << 13;
+    benchState ^= benchState >> 7;
+    benchState ^= benchState << 17;
+    return (unsigned int) (benchState >> 32);
+}
+
+// BITMAP: a revealed layer made of large round openings, as left behind by
+// flood fills on a huge sparse board.
+static void benchBitmap(void) {
+    const int size = 8192;
+    const int blobs = 400;
+    const int probes = 20000000;
+    int *blobX = malloc(blobs * sizeof(int));
+    int *blobY = malloc(blobs * sizeof(int));
+    int *blobR = malloc(blobs * sizeof(int));
+    for (int i = 0; i < blobs; i++) {
+        blobX[i] = benchRand() % size;
+        blobY[i] = benchRand() % size;
+        blobR[i] = 32 + benchRand() % 256;
+    }
+
+    RunBitmap runs;
+    DenseBitmap dense;
+    runBitmapInit(&runs, size, size);
+    denseBitmapInit(&dense, size, size);
+
+    double t0 = nowSeconds();
+    long spans = 0;
+    for (int i = 0; i < blobs; i++) {
+        for (int dx = -blobR[i]; dx <= blobR[i]; dx++) {
+            int x = blobX[i] + dx;
+            if (x < 0 || x >= size) continue;
+            int half = 0;
+            while ((half + 1) * (half + 1) + dx * dx <= blobR[i] * blobR[i]) half++;
+            int start = blobY[i] - half < 0 ? 0 : blobY[i] - half;
+            int end = blobY[i] + half + 1 > size ? size : blobY[i] + half + 1;
+            runBitmapSetRange(&runs, x, start, end);
+            spans++;
+        }
+    }
+    double runSet = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    for (int i = 0; i < blobs; i++) {
+        for (int dx = -blobR[i]; dx <= blobR[i]; dx++) {
+            int x = blobX[i] + dx;
+            if (x < 0 || x >= size) continue;
+            int half = 0;
+            while ((half + 1) * (half + 1) + dx * dx <= blobR[i] * blobR[i]) half++;
+            int start = blobY[i] - half < 0 ? 0 : blobY[i] - half;
+            int end = blobY[i] + half + 1 > size ? size : blobY[i] + half + 1;
+            denseBitmapSetRange(&dense, x, start, end);
+        }
+    }
+    double denseSet = nowSeconds() - t0;
+
+    unsigned long long saved = benchState;
+    long hits = 0;
+    t0 = nowSeconds();
+    for (int i = 0; i < probes; i++) {
+        hits += runBitmapTest(&runs, benchRand() % size, benchRand() % size);
+    }
+    double runTest = nowSeconds() - t0;
+
+    benchState = saved;
+    long denseHits = 0;
+    t0 = nowSeconds();
+    for (int i = 0; i < probes; i++) {
+        denseHits += denseBitmapTest(&dense, benchRand() % size, benchRand() % size);
+    }
+    double denseTest = nowSeconds() - t0;
+
+    long revealed = runBitmapCount(&runs);
+    bool mismatch = hits != denseHits || revealed != denseBitmapCount(&dense);
+
+    t0 = nowSeconds();
+    for (int i = 0; i < 1000000; i++) {
+        int x = benchRand() % size, y = benchRand() % size;
+        runBitmapSet(&runs, x, y);
+        runBitmapReset(&runs, x, y);
+    }
+    double runToggle = nowSeconds() - t0;
+
+    printf("bitmap %dx%d, %ld revealed cells in %ld spans\n", size, size, revealed, spans);
+    printf("  run-length: %9zu bytes  range-set %6.1f Mspans/s  test %6.1f Mops/s  set+reset %6.1f Mops/s\n",
+           runBitmapBytes(&runs), spans / runSet / 1e6, probes / runTest / 1e6, 1.0 / runToggle);
+    printf("  dense:      %9zu bytes  range-set %6.1f Mspans/s  test %6.1f Mops/s\n",
+           denseBitmapBytes(&dense), spans / denseSet / 1e6, probes / denseTest / 1e6);
+
+    if (mismatch) {
+        printf("  MISMATCH between run-length and dense layers\n");
+    }
+
+    runBitmapFree(&runs);
+    denseBitmapFree(&dense);
+    free(blobX);
+    free(blobY);
+    free(blobR);
+}
+
+static Status benchStatus(int width, int height, int bombs) {
+    Status status = {
+            .W_TILES = width,
+            .H_TILES = height,
+            .BOMBS = bombs,
+            .STATE = PLAYING,
+            .VISIBLE_TILES = 0,
+            .FIRST_CELL = ANY
+    };
+    return status;
+}
+
+static void hideAll(TILE **board, Status *status) {
+    for (int x = 0; x < status->W_TILES; x++) {
+        for (int y = 0; y < status->H_TILES; y++) {
+            board[x][y].VISIBLE = false;
+        }
+    }
+    status->VISIBLE_TILES = 0;
+    status->STATE = PLAYING;
+}
+
+// OPENINGS: flood fill against the precomputed sweep on the largest opening
+static void benchOpenings(void) {
+    const int sizes[] = {64, 256, 640};
+    for (int s = 0; s < 3; s++) {
+        int size = sizes[s];
+        Status status = benchStatus(size, size, size * size / 40);
+        TILE **board = allocBoard(size, size);
+        srand(1234);
+        initializeBoard(board, size, size);
+        generateBombs(board, status.BOMBS, status);
+        generateNumbers(board, &status);
+
+        OpeningMap map = {0};
+        FloodWork work = {0};
+        int builds = size < 256 ? 2000 : 20;
+        double t0 = nowSeconds();
+        for (int i = 0; i < builds; i++) {
+            buildOpeningMap(board, status, &map);
+        }
+        double build = (nowSeconds() - t0) / builds;
+
+        int largest = 0;
+        for (int r = 1; r < map.COUNT; r++) {
+            if (map.START[r + 1] - map.START[r] > map.START[largest + 1] - map.START[largest]) largest = r;
+        }
+        int cell = map.CELLS[map.START[largest]];
+        int x = cell / size, y = cell % size;
+
+        int reps = size < 256 ? 2000 : 20;
+        double flood = 0, sweep = 0;
+        int floodVisible = 0, sweepVisible = 0;
+        for (int i = 0; i < reps; i++) {
+            hideAll(board, &status);
+            t0 = nowSeconds();
+            revealEmptyCells(board, x, y, &status, &work);
+            flood += nowSeconds() - t0;
+            floodVisible = status.VISIBLE_TILES;
+
+            hideAll(board, &status);
+            t0 = nowSeconds();
+            revealOpening(board, &map, x, y, &status, &work, NULL);
+            sweep += nowSeconds() - t0;
+            sweepVisible = status.VISIBLE_TILES;
+        }
+
+        printf("openings %dx%d: %d openings, 3BV %d, build %.3f ms, largest reveals %d cells\n",
+               size, size, map.COUNT, map.BBBV, build * 1e3, sweepVisible);
+        printf("  flood fill %8.1f us  precomputed sweep %8.1f us  (%.1fx)%s\n",
+               flood / reps * 1e6, sweep / reps * 1e6, flood / sweep,
+               floodVisible == sweepVisible ? "" : "  MISMATCH");
+
+        freeOpeningMap(&map);
+        freeFloodWork(&work);
+        freeMem(status, board);
+    }
+}
+
+// CHORD: clear a board with every mine flagged, once by tapping each hidden
+// safe cell and once by chording satisfied numbers after the first opening
+static void benchChord(void) {
+    const int size = 512;
+    Status status = benchStatus(size, size, size * size / 6);
+    TILE **board = allocBoard(size, size);
+    srand(4321);
+    initializeBoard(board, size, size);
+    generateBombs(board, status.BOMBS, status);
+    generateNumbers(board, &status);
+    for (int x = 0; x < size; x++) {
+        for (int y = 0; y < size; y++) {
+            if (board[x][y].TYPE == MINE) board[x][y].MARK = CELL_FLAGGED;
+        }
+    }
+    FloodWork work = {0};
+
+    long taps = 0;
+    double t0 = nowSeconds();
+    for (int x = 0; x < size; x++) {
+        for (int y = 0; y < size; y++) {
+            if (!board[x][y].VISIBLE && board[x][y].MARK != CELL_FLAGGED) {
+                revealEmptyCells(board, x, y, &status, &work);
+                taps++;
+            }
+        }
+    }
+    double tapTime = nowSeconds() - t0;
+    State tapState = status.STATE;
+
+    hideAll(board, &status);
+    long chords = 0;
+    int startX = 0, startY = 0;
+    for (int x = 0; x < size; x++) {
+        for (int y = 0; y < size; y++) {
+            if (board[x][y].TYPE == NUMBER) {
+                startX = x;
+                startY = y;
+                x = size;
+                break;
+            }
+        }
+    }
+    // Every mine is flagged, so a number can chord as soon as it shows: each
+    // cell an event opens is tried once, from the change log
+    work.RECORD = true;
+    work.CHANGE_COUNT = 0;
+    int *pending = malloc((size_t) size * size * sizeof(int));
+    int count = 0;
+    t0 = nowSeconds();
+    revealEmptyCells(board, startX, startY, &status, &work);
+    for (int c = 0; c < work.CHANGE_COUNT; c++) {
+        pending[count++] = (int) (work.CHANGES[c] >> 4);
+    }
+    while (count > 0) {
+        int cell = pending[--count];
+        work.CHANGE_COUNT = 0;
+        if (chordCell(board, cell / size, cell % size, &status, &work) && work.CHANGE_COUNT > 0) {
+            chords++;
+            for (int c = 0; c < work.CHANGE_COUNT; c++) {
+                pending[count++] = (int) (work.CHANGES[c] >> 4);
+            }
+        }
+    }
+    double chordTime = nowSeconds() - t0;
+    free(pending);
+
+    printf("chord %dx%d, %d mines flagged\n", size, size, status.BOMBS);
+    printf("  single taps: %8ld events %8.1f ms  %s\n", taps, tapTime * 1e3, tapState == WIN ? "WIN" : "not won");
+    printf("  chording:    %8ld events %8.1f ms  %s (%d cells)\n", chords + 1, chordTime * 1e3,
+           status.STATE == WIN ? "WIN" : "not won", status.VISIBLE_TILES);
+
+    freeFloodWork(&work);
+    freeMem(status, board);
+}
+
+static uint64_t boardChecksum(TILE **board, Status status) {
+    uint64_t sum = 0;
+    for (int x = 0; x < status.W_TILES; x++) {
+        for (int y = 0; y < status.H_TILES; y++) {
+            sum = sum * 31 + (board[x][y].VISIBLE | board[x][y].MARK << 1 | board[x][y].TYPE << 3);
+        }
+    }
+    return sum;
+}
+
+// HISTORY: a long game of random taps and flags on a huge board, recorded
+// into a bounded log, then fully undone and redone
+static void benchHistory(void) {
+    const int size = 1024;
+    const long capacities[] = {1L << 24, 1L << 16};
+    for (int c = 0; c < 2; c++) {
+        Status status = benchStatus(size, size, size * size / 8);
+        TILE **board = allocBoard(size, size);
+        srand(99);
+        initializeBoard(board, size, size);
+        generateBombs(board, status.BOMBS, status);
+        generateNumbers(board, &status);
+        uint64_t start = boardChecksum(board, status);
+
+        FloodWork work = {0};
+        History history;
+        historyInit(&history, 1 << 20, capacities[c]);
+
+        long actions = 0;
+        benchState = 77;
+        double t0 = nowSeconds();
+        while (status.STATE == PLAYING && actions < 400000) {
+            int x = benchRand() % size, y = benchRand() % size;
+            if (board[x][y].VISIBLE) continue;
+            historyBegin(&history, status, &work);
+            if (board[x][y].TYPE == MINE || benchRand() % 4 == 0) {
+                markCell(board, x, y, status, &work);
+            } else if (board[x][y].MARK != CELL_FLAGGED) {
+                revealEmptyCells(board, x, y, &status, &work);
+            }
+            historyCommit(&history, board, status, &work);
+            actions++;
+        }
+        double play = nowSeconds() - t0;
+        uint64_t end = boardChecksum(board, status);
+        long kept = history.LAST - history.FIRST;
+        long changes = history.LOG_END - history.STEPS[history.FIRST % history.STEP_CAPACITY].START;
+
+        t0 = nowSeconds();
+        while (historyUndo(&history, board, &status)) {}
+        double undo = nowSeconds() - t0;
+        bool restored = history.FIRST > 0 || boardChecksum(board, status) == start;
+
+        t0 = nowSeconds();
+        while (historyRedo(&history, board, &status)) {}
+        double redo = nowSeconds() - t0;
+        bool replayed = boardChecksum(board, status) == end;
+
+        printf("history %dx%d, log %ld entries (%zu KB): %ld actions, %ld steps / %ld cells kept\n",
+               size, size, capacities[c], historyBytes(&history) / 1024, actions, kept, changes);
+        printf("  record %6.1f ns/action  undo %6.2f ns/cell  redo %6.2f ns/cell  %s\n",
+               play / actions * 1e9, undo / changes * 1e9, redo / changes * 1e9,
+               restored && replayed ? "ok" : "MISMATCH");
+
+        historyFree(&history);
+        freeFloodWork(&work);
+        freeMem(status, board);
+    }
+}
+
+// SAVE: snapshot a half-played board to disk and restore it
+static void benchSave(void) {
+    const int sizes[] = {16, 256, 1024, 4096};
+    const char *path = "bench_save.sav";
+    for (int s = 0; s < 4; s++) {
+        int size = sizes[s];
+        Status status = benchStatus(size, size, size * size / 6);
+        TILE **board = allocBoard(size, size);
+        srand(5);
+        initializeBoard(board, size, size);
+        generateBombs(board, status.BOMBS, status);
+        generateNumbers(board, &status);
+        FloodWork work = {0};
+        for (int i = 0; i < size * 4; i++) {
+            int x = rand() % size, y = rand() % size;
+            if (board[x][y].TYPE == MINE) {
+                board[x][y].MARK = CELL_FLAGGED;
+            } else if (board[x][y].MARK != CELL_FLAGGED) {
+                revealEmptyCells(board, x, y, &status, &work);
+            }
+        }
+        uint64_t before = boardChecksum(board, status);
+
+        int reps = size <= 256 ? 200 : 5;
+        double save = 0, load = 0;
+        bool ok = true;
+        for (int i = 0; i < reps; i++) {
+            double t0 = nowSeconds();
+            ok &= saveGameFile(path, board, status);
+            save += nowSeconds() - t0;
+
+            initializeBoard(board, size, size);
+            Status restored = benchStatus(size, size, 0);
+            t0 = nowSeconds();
+            ok &= loadGameFile(path, board, &restored);
+            load += nowSeconds() - t0;
+            ok &= restored.VISIBLE_TILES == status.VISIBLE_TILES && restored.BOMBS == status.BOMBS;
+        }
+        ok &= boardChecksum(board, status) == before;
+
+        printf("save %4dx%-4d %9zu bytes  save %9.1f us  load %9.1f us  %s\n", size, size,
+               saveGameSize(status), save / reps * 1e6, load / reps * 1e6, ok ? "ok" : "MISMATCH");
+
+        freeFloodWork(&work);
+        freeMem(status, board);
+    }
+    remove(path);
+}
+
+static TILE **benchBoard(Status *status, unsigned int seed) {
+    TILE **board = allocBoard(status->W_TILES, status->H_TILES);
+    srand(seed);
+    initializeBoard(board, status->W_TILES, status->H_TILES);
+    generateBombs(board, status->BOMBS, *status);
+    generateNumbers(board, status);
+    return board;
+}
+
+static bool firstBlank(TILE **board, Status status, int *x, int *y) {
+    for (int i = 0; i < status.W_TILES; i++) {
+        for (int j = 0; j < status.H_TILES; j++) {
+            if (board[i][j].TYPE == BLANK_TILE) {
+                *x = i;
+                *y = j;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// SOLVER: open the first blank, then keep revealing whatever the solver
+// proves safe, timing the incremental runs against a full rescan
+static void benchSolver(void) {
+    const int widths[] = {30, 1024};
+    const int heights[] = {16, 1024};
+    const int games[] = {2000, 2};
+    for (int s = 0; s < 2; s++) {
+        double incremental = 0, rescan = 0;
+        long runs = 0, solved = 0, revealed = 0, wrong = 0;
+        for (int g = 0; g < games[s]; g++) {
+            Status status = benchStatus(widths[s], heights[s], widths[s] * heights[s] * 99 / 480);
+            TILE **board = benchBoard(&status, g + 1);
+            int x, y;
+            if (!firstBlank(board, status, &x, &y)) {
+                freeMem(status, board);
+                continue;
+            }
+            Solver solver;
+            solverInit(&solver, status);
+            FloodWork work = {0};
+            work.RECORD = true;
+            revealEmptyCells(board, x, y, &status, &work);
+            solverUpdate(&solver, board, status, &work);
+
+            while (status.STATE == PLAYING) {
+                double t0 = nowSeconds();
+                solverRun(&solver, board, status);
+                incremental += nowSeconds() - t0;
+                runs++;
+
+                if (s == 0) {
+                    Solver fresh;
+                    solverInit(&fresh, status);
+                    t0 = nowSeconds();
+                    solverScan(&fresh, board, status);
+                    solverRun(&fresh, board, status);
+                    rescan += nowSeconds() - t0;
+                    solverFree(&fresh);
+                }
+
+                work.CHANGE_COUNT = 0;
+                for (int i = 0; i < solver.SAFE_COUNT; i++) {
+                    int cell = solver.SAFE[i];
+                    revealEmptyCells(board, cell / status.H_TILES, cell % status.H_TILES, &status, &work);
+                }
+                solver.SAFE_COUNT = 0;
+                if (work.CHANGE_COUNT == 0) break;
+                revealed += work.CHANGE_COUNT;
+                solverUpdate(&solver, board, status, &work);
+            }
+            for (int i = 0; i < solver.MINE_COUNT; i++) {
+                int cell = solver.MINES[i];
+                wrong += board[cell / status.H_TILES][cell % status.H_TILES].TYPE != MINE;
+            }
+            wrong += status.STATE == LOSE;
+            solved += status.STATE == WIN;
+
+            freeFloodWork(&work);
+            solverFree(&solver);
+            freeMem(status, board);
+        }
+        printf("solver %dx%d: %d games, %ld solved without guessing, %ld cells revealed, %ld wrong\n",
+               widths[s], heights[s], games[s], solved, revealed, wrong);
+        printf("  incremental %8.2f us/run", incremental / runs * 1e6);
+        if (rescan > 0) {
+            printf("  full rescan %8.2f us/run", rescan / runs * 1e6);
+        }
+        printf("  (%ld runs)\n", runs);
+    }
+}
+
+// Replays a generated board from the first click with the solver alone
+static bool solvableFrom(TILE **board, Status status, int x, int y) {
+    Solver solver;
+    solverInit(&solver, status);
+    FloodWork work = {0};
+    work.RECORD = true;
+    status.STATE = PLAYING;
+    revealEmptyCells(board, x, y, &status, &work);
+    solverUpdate(&solver, board, status, &work);
+    while (status.STATE == PLAYING && solverRun(&solver, board, status) > 0) {
+        work.CHANGE_COUNT = 0;
+        for (int i = 0; i < solver.SAFE_COUNT; i++) {
+            revealEmptyCells(board, solver.SAFE[i] / status.H_TILES, solver.SAFE[i] % status.H_TILES, &status, &work);
+        }
+        solver.SAFE_COUNT = 0;
+        solverUpdate(&solver, board, status, &work);
+    }
+    for (int i = 0; i < status.W_TILES; i++) {
+        for (int j = 0; j < status.H_TILES; j++) {
+            board[i][j].VISIBLE = false;
+        }
+    }
+    freeFloodWork(&work);
+    solverFree(&solver);
+    return status.STATE == WIN;
+}
+
+// NOGUESS: boards per second and how many candidates and repairs they took
+static void benchNoGuess(void) {
+    const char *names[] = {"beginner", "intermediate", "expert"};
+    const int widths[] = {9, 16, 30};
+    const int heights[] = {9, 16, 16};
+    const int mines[] = {10, 40, 99};
+    const int boards = 2000;
+    for (int level = 0; level < 3; level++) {
+        Status status = benchStatus(widths[level], heights[level], mines[level]);
+        TILE **board = allocBoard(status.W_TILES, status.H_TILES);
+        NoGuess noGuess;
+        noGuessInit(&noGuess, status);
+        Rng rng = {level + 1};
+
+        long candidates[4] = {0}, repairs[4] = {0};
+        int generated = 0, verified = 0;
+        double t0 = nowSeconds();
+        for (int b = 0; b < boards; b++) {
+            int x = rngRange(&rng, status.W_TILES), y = rngRange(&rng, status.H_TILES);
+            status.BOMBS = mines[level];
+            if (!generateNoGuess(board, &status, x, y, &rng, &noGuess)) continue;
+            generated++;
+            candidates[noGuess.CANDIDATES > 3 ? 3 : noGuess.CANDIDATES - 1]++;
+            repairs[noGuess.REPAIRS == 0 ? 0 : noGuess.REPAIRS <= 5 ? 1 : noGuess.REPAIRS <= 20 ? 2 : 3]++;
+        }
+        double elapsed = nowSeconds() - t0;
+
+        rng = (Rng) {level + 1};
+        for (int b = 0; b < 200; b++) {
+            int x = rngRange(&rng, status.W_TILES), y = rngRange(&rng, status.H_TILES);
+            status.BOMBS = mines[level];
+            if (generateNoGuess(board, &status, x, y, &rng, &noGuess)) {
+                verified += solvableFrom(board, status, x, y);
+            }
+        }
+
+        printf("noguess %-12s %2dx%-2d %3d mines: %8.0f boards/s, %d/%d generated, %d/200 re-verified\n",
+               names[level], status.W_TILES, status.H_TILES, mines[level], generated / elapsed, generated, boards, verified);
+        printf("  candidates 1:%ld 2:%ld 3:%ld 4+:%ld   repairs 0:%ld 1-5:%ld 6-20:%ld 21+:%ld\n",
+               candidates[0], candidates[1], candidates[2], candidates[3], repairs[0], repairs[1], repairs[2], repairs[3]);
+
+        noGuessFree(&noGuess);
+        freeMem(status, board);
+    }
+}
+
+// NOGUESS-PARALLEL: dense expert boards searched with 1..N workers, checking
+// that a seed yields the same board whatever the worker count
+static void benchNoGuessParallel(void) {
+    const int threadCounts[] = {1, 2, 4, 8};
+    const int boards = 200;
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    uint64_t reference[200];
+    double single = 0;
+    printf("noguess-parallel 30x16 130 mines, %ld cores online\n", cores);
+    for (int t = 0; t < 4; t++) {
+        int threads = threadCounts[t];
+        Status status = benchStatus(30, 16, 130);
+        TILE **board = allocBoard(30, 16);
+        int generated = 0;
+        bool deterministic = true;
+        long tried = 0;
+        double t0 = nowSeconds();
+        for (int b = 0; b < boards; b++) {
+            status.BOMBS = 130;
+            int winner = generateNoGuessParallel(board, &status, b % 30, b % 16, 1000 + b, threads, 5000);
+            if (winner < 0) continue;
+            generated++;
+            tried += winner + 1;
+            uint64_t sum = boardChecksum(board, status);
+            if (t == 0) {
+                reference[b] = sum;
+            } else if (reference[b] != sum) {
+                deterministic = false;
+            }
+        }
+        double elapsed = nowSeconds() - t0;
+        if (t == 0) single = elapsed;
+        printf("  %d threads: %7.1f boards/s  speedup %4.2fx  %d/%d generated, winner index avg %.1f  %s\n",
+               threads, generated / elapsed, single / elapsed, generated, boards,
+               generated ? (double) tried / generated : 0.0, deterministic ? "deterministic" : "BOARDS DIFFER");
+        freeMem(status, board);
+    }
+}
+
+// Reveal what the solver proves from the first blank until it gets stuck
+static void solveUntilStuck(TILE **board, Status *status, Solver *solver, FloodWork *work) {
+    work->RECORD = true;
+    while (status->STATE == PLAYING && solverRun(solver, board, *status) > 0) {
+        work->CHANGE_COUNT = 0;
+        for (int i = 0; i < solver->SAFE_COUNT; i++) {
+            revealEmptyCells(board, solver->SAFE[i] / status->H_TILES, solver->SAFE[i] % status->H_TILES, status, work);
+        }
+        solver->SAFE_COUNT = 0;
+        solverUpdate(solver, board, *status, work);
+    }
+}
+
+// PROBABILITY: stuck expert positions, then adversarial ones where scattered
+// reveals leave one large tangled frontier
+static void benchProbability(void) {
+    const char *names[] = {"expert stuck", "expert scattered", "100x100 scattered"};
+    const int sizes[][2] = {{30, 16}, {30, 16}, {100, 100}};
+    const int positions[] = {2000, 200, 20};
+    for (int kind = 0; kind < 3; kind++) {
+        double total = 0, worst = 0;
+        long frontier = 0, components = 0, inexact = 0, measured = 0;
+        for (int g = 0; g < positions[kind]; g++) {
+            Status status = benchStatus(sizes[kind][0], sizes[kind][1], sizes[kind][0] * sizes[kind][1] * 99 / 480);
+            TILE **board = benchBoard(&status, 500 + g);
+            Solver solver;
+            solverInit(&solver, status);
+            FloodWork work = {0};
+            int x, y;
+            if (kind == 0 && firstBlank(board, status, &x, &y)) {
+                work.RECORD = true;
+                revealEmptyCells(board, x, y, &status, &work);
+                solverUpdate(&solver, board, status, &work);
+                solveUntilStuck(board, &status, &solver, &work);
+            } else if (kind > 0) {
+                for (int i = 0; i < status.W_TILES; i++) {
+                    for (int j = 0; j < status.H_TILES; j++) {
+                        if (board[i][j].TYPE != MINE && rand() % 3 == 0) {
+                            board[i][j].VISIBLE = true;
+                            status.VISIBLE_TILES++;
+                        }
+                    }
+                }
+                solverScan(&solver, board, status);
+                solverRun(&solver, board, status);
+            }
+            if (status.STATE == PLAYING) {
+                Probability probability;
+                probabilityInit(&probability, status);
+                double t0 = nowSeconds();
+                computeProbabilities(&probability, board, status, &solver);
+                double elapsed = nowSeconds() - t0;
+                total += elapsed;
+                if (elapsed > worst) worst = elapsed;
+                frontier += probability.FRONTIER;
+                components += probability.COMPONENTS;
+                inexact += !probability.EXACT;
+                measured++;
+                probabilityFree(&probability);
+            }
+            freeFloodWork(&work);
+            solverFree(&solver);
+            freeMem(status, board);
+        }
+        printf("probability %-18s %5ld positions: avg %8.1f us  worst %8.1f us  frontier %6.1f cells in %5.1f components, %ld over budget\n",
+               names[kind], measured, total / measured * 1e6, worst * 1e6,
+               (double) frontier / measured, (double) components / measured, inexact);
+    }
+}
+
+// CACHE: bot games that guess the lowest probability cell whenever the
+// solver is stuck, computing every position with and without the cache
+static void benchCache(void) {
+    const char *names[] = {"expert", "100x100"};
+    const int sizes[][3] = {{30, 16, 99}, {100, 100, 2063}};
+    const int games[] = {500, 10};
+    for (int kind = 0; kind < 2; kind++) {
+        ProbabilityCache cache;
+        probabilityCacheInit(&cache, 1024, 16 << 20);
+        double plain = 0, cached = 0;
+        long positions = 0, mismatches = 0, wins = 0;
+        for (int g = 0; g < games[kind]; g++) {
+            Status status = benchStatus(sizes[kind][0], sizes[kind][1], sizes[kind][2]);
+            TILE **board = benchBoard(&status, 1300 + g);
+            int x, y;
+            if (!firstBlank(board, status, &x, &y)) {
+                freeMem(status, board);
+                continue;
+            }
+            Solver solver;
+            solverInit(&solver, status);
+            Probability fresh, reused;
+            probabilityInit(&fresh, status);
+            probabilityInit(&reused, status);
+            reused.CACHE = &cache;
+            FloodWork work = {0};
+            work.RECORD = true;
+            revealEmptyCells(board, x, y, &status, &work);
+            solverUpdate(&solver, board, status, &work);
+
+            while (status.STATE == PLAYING) {
+                solveUntilStuck(board, &status, &solver, &work);
+                if (status.STATE != PLAYING) break;
+                double t0 = nowSeconds();
+                computeProbabilities(&fresh, board, status, &solver);
+                double t1 = nowSeconds();
+                computeProbabilities(&reused, board, status, &solver);
+                plain += t1 - t0;
+                cached += nowSeconds() - t1;
+                positions++;
+
+                int best = -1, cells = status.W_TILES * status.H_TILES;
+                mismatches += memcmp(fresh.PROB, reused.PROB, cells * sizeof(float)) != 0;
+                for (int i = 0; i < cells; i++) {
+                    if (fresh.PROB[i] >= 0 && solver.KNOWN[i] == KNOWN_NOTHING
+                        && (best < 0 || fresh.PROB[i] < fresh.PROB[best])) {
+                        best = i;
+                    }
+                }
+                if (best < 0) break;
+                work.CHANGE_COUNT = 0;
+                revealEmptyCells(board, best / status.H_TILES, best % status.H_TILES, &status, &work);
+                solverUpdate(&solver, board, status, &work);
+            }
+            wins += status.STATE == WIN;
+            freeFloodWork(&work);
+            probabilityFree(&fresh);
+            probabilityFree(&reused);
+            solverFree(&solver);
+            freeMem(status, board);
+        }
+        printf("cache %-8s %4d games, %3ld won, %6ld positions: uncached %8.1f us  cached %8.1f us  (%.2fx)"
+               "  hit rate %5.1f%%  %ld mismatches  %zu KiB held\n",
+               names[kind], games[kind], wins, positions, plain / positions * 1e6, cached / positions * 1e6,
+               plain / cached, 100.0 * cache.HITS / (cache.HITS + cache.MISSES), mismatches, cache.BYTES / 1024);
+        probabilityCacheFree(&cache);
+    }
+}
+
+// LINEAR: each game played from the first blank until stuck once per backend.
+// Positions the propagation rules finish must come out identical under
+// elimination; elsewhere elimination may only reveal more.
+static void benchLinear(void) {
+    const char *names[] = {"beginner", "expert", "100x100"};
+    const int sizes[][3] = {{9, 9, 10}, {30, 16, 99}, {100, 100, 2063}};
+    const int games[] = {2000, 2000, 50};
+    for (int kind = 0; kind < 3; kind++) {
+        double elapsed[2] = {0, 0};
+        long revealed[2] = {0, 0}, solved[2] = {0, 0}, wrong[2] = {0, 0}, differ = 0, played = 0;
+        for (int g = 0; g < games[kind]; g++) {
+            uint64_t sum[2] = {0, 0};
+            bool finished[2] = {false, false};
+            for (int backend = 0; backend < 2; backend++) {
+                Status status = benchStatus(sizes[kind][0], sizes[kind][1], sizes[kind][2]);
+                TILE **board = benchBoard(&status, 900 + g);
+                int x, y;
+                if (!firstBlank(board, status, &x, &y)) {
+                    freeMem(status, board);
+                    break;
+                }
+                Solver solver;
+                solverInit(&solver, status);
+                solver.BACKEND = backend == 0 ? SOLVER_PROPAGATION : SOLVER_LINEAR;
+                FloodWork work = {0};
+                work.RECORD = true;
+                revealEmptyCells(board, x, y, &status, &work);
+                solverUpdate(&solver, board, status, &work);
+                double t0 = nowSeconds();
+                solveUntilStuck(board, &status, &solver, &work);
+                elapsed[backend] += nowSeconds() - t0;
+
+                for (int i = 0; i < solver.MINE_COUNT; i++) {
+                    wrong[backend] += board[solver.MINES[i] / status.H_TILES][solver.MINES[i] % status.H_TILES].TYPE != MINE;
+                }
+                wrong[backend] += status.STATE == LOSE;
+                solved[backend] += status.STATE == WIN;
+                revealed[backend] += status.VISIBLE_TILES;
+                sum[backend] = boardChecksum(board, status);
+                finished[backend] = status.STATE == WIN;
+                played += backend;
+                freeFloodWork(&work);
+                solverFree(&solver);
+                freeMem(status, board);
+            }
+            differ += finished[0] && (!finished[1] || sum[0] != sum[1]);
+        }
+        printf("linear %-9s %5ld games: propagation %8.1f us/game %5ld solved | elimination %8.1f us/game %5ld solved"
+               "  (+%ld cells, %ld wrong, %ld differ)\n",
+               names[kind], played, elapsed[0] / played * 1e6, solved[0], elapsed[1] / played * 1e6, solved[1],
+               revealed[1] - revealed[0], wrong[0] + wrong[1], differ);
+        printf("  local rules and pattern table reveal %.1f%% of what elimination reaches\n",
+               100.0 * revealed[0] / revealed[1]);
+    }
+}
+
+// Border numbers found by scanning the whole board, the way callers did
+// before the frontier index
+static int scanFrontier(TILE **board, Status status, int *out) {
+    int count = 0;
+    for (int x = 0; x < status.W_TILES; x++) {
+        for (int y = 0; y < status.H_TILES; y++) {
+            if (!board[x][y].VISIBLE || board[x][y].TYPE != NUMBER) {
+                continue;
+            }
+            bool border = false;
+            for (int d = 0; d < 9 && !border; d++) {
+                int nx = x + d / 3 - 1, ny = y + d % 3 - 1;
+                border = nx >= 0 && nx < status.W_TILES && ny >= 0 && ny < status.H_TILES && !board[nx][ny].VISIBLE;
+            }
+            if (border) {
+                out[count++] = x * status.H_TILES + y;
+            }
+        }
+    }
+    return count;
+}
+
+// FRONTIER: random reveals and flags with the index maintained, checked
+// against a rebuild, then frontier queries by scan and by index. Each
+// reveal is timed twice, undone in between: without upkeep and with it.
+static void benchFrontier(void) {
+    const int sizes[][3] = {{30, 16, 99}, {1000, 1000, 150000}};
+    const int moves[] = {200000, 200000};
+    for (int kind = 0; kind < 2; kind++) {
+        Status status = benchStatus(sizes[kind][0], sizes[kind][1], sizes[kind][2]);
+        int cells = status.W_TILES * status.H_TILES;
+        Frontier frontier, check;
+        frontierInit(&frontier, status);
+        frontierInit(&check, status);
+        FloodWork plain = {0}, tracked = {0};
+        plain.RECORD = true;
+        tracked.FRONTIER = &frontier;
+        int *scanned = malloc(cells * sizeof(int));
+        TILE **board = NULL;
+
+        double withIndex = 0, without = 0, scan = 0, walk = 0;
+        long reveals = 0, queries = 0, mismatches = 0, size = 0, sink = 0;
+        for (int m = 0, game = 0; m < moves[kind]; m++) {
+            if (board == NULL || status.STATE != PLAYING) {
+                if (board != NULL) freeMem(status, board);
+                status = benchStatus(sizes[kind][0], sizes[kind][1], sizes[kind][2]);
+                board = benchBoard(&status, 77 + game++);
+                frontierBuild(&frontier, board, status);
+            }
+            int x = benchRand() % status.W_TILES, y = benchRand() % status.H_TILES;
+            if (board[x][y].TYPE == MINE) {
+                markCell(board, x, y, status, &tracked);
+                continue;
+            }
+
+            Status before = status;
+            plain.CHANGE_COUNT = 0;
+            double t0 = nowSeconds();
+            revealEmptyCells(board, x, y, &status, &plain);
+            without += nowSeconds() - t0;
+            for (int c = plain.CHANGE_COUNT - 1; c >= 0; c--) {
+                int i = plain.CHANGES[c] >> 4;
+                board[i / status.H_TILES][i % status.H_TILES].VISIBLE = plain.CHANGES[c] & 1;
+            }
+            status = before;
+            t0 = nowSeconds();
+            revealEmptyCells(board, x, y, &status, &tracked);
+            withIndex += nowSeconds() - t0;
+            reveals++;
+
+            if (m % 1000 == 0) {
+                t0 = nowSeconds();
+                int found = scanFrontier(board, status, scanned);
+                double t1 = nowSeconds();
+                for (int i = 0; i < frontier.COUNT; i++) {
+                    sink += frontier.MEMBERS[i];
+                }
+                walk += nowSeconds() - t1;
+                scan += t1 - t0;
+                queries++;
+                size += frontier.COUNT;
+                frontierBuild(&check, board, status);
+                mismatches += found != frontier.COUNT || check.COUNT != frontier.COUNT
+                              || memcmp(check.HIDDEN, frontier.HIDDEN, cells) != 0
+                              || memcmp(check.FLAGGED, frontier.FLAGGED, cells) != 0;
+            }
+        }
+        printf("frontier %4dx%-4d reveal %6.3f us plain, %6.3f us with upkeep | query, %6ld members: scan %9.1f us, index %7.2f us (%ld checks, %ld mismatches)\n",
+               status.W_TILES, status.H_TILES, without / reveals * 1e6, withIndex / reveals * 1e6,
+               size / queries, scan / queries * 1e6, walk / queries * 1e6, queries, mismatches + (sink < 0));
+        free(scanned);
+        freeFloodWork(&plain);
+        freeFloodWork(&tracked);
+        frontierFree(&frontier);
+        frontierFree(&check);
+        freeMem(status, board);
+    }
+}
+
+// HINT: games played by following the hint alone. Small boards answer inside
+// hintRequest; on huge ones the request only snapshots the board, and the
+// answer is polled the way the render loop does.
+static int compareDouble(const void *a, const void *b) {
+    double x = *(const double *) a, y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+static void benchHint(void) {
+    static double samples[1 << 16];
+    const int sizes[][3] = {{10, 18, 35}, {30, 16, 99}, {1000, 1000, 150000}};
+    const int games[] = {300, 300, 1};
+    const int maxHints[] = {1000, 1000, 40};
+    for (int kind = 0; kind < 3; kind++) {
+        double blocked = 0, worstBlocked = 0, latency = 0;
+        long hints = 0, safe = 0, wrong = 0, polls = 0, wins = 0;
+        for (int g = 0; g < games[kind]; g++) {
+            Status status = benchStatus(sizes[kind][0], sizes[kind][1], sizes[kind][2]);
+            TILE **board = benchBoard(&status, 2100 + g);
+            int x, y;
+            if (!firstBlank(board, status, &x, &y)) {
+                freeMem(status, board);
+                continue;
+            }
+            Frontier frontier;
+            frontierInit(&frontier, status);
+            frontierBuild(&frontier, board, status);
+            FloodWork work = {0};
+            work.FRONTIER = &frontier;
+            work.RECORD = true;
+            Hint hint;
+            hintInit(&hint, status);
+            revealEmptyCells(board, x, y, &status, &work);
+            hintTrack(&hint, &work);
+            work.CHANGE_COUNT = 0;
+
+            for (unsigned int move = 0; status.STATE == PLAYING && move < (unsigned int) maxHints[kind]; move++) {
+                double t0 = nowSeconds();
+                hintRequest(&hint, board, status, &frontier, move);
+                double spent = nowSeconds() - t0;
+                blocked += spent;
+                if (spent > worstBlocked) worstBlocked = spent;
+                if (hints < (1 << 16)) samples[hints] = spent;
+                while (!hintPoll(&hint)) {
+                    polls++;
+                    usleep(1000);
+                }
+                latency += hint.SECONDS;
+                hints++;
+                if (hint.CELL < 0) break;
+                int cx = hint.CELL / status.H_TILES, cy = hint.CELL % status.H_TILES;
+                safe += hint.SAFE;
+                wrong += hint.SAFE && board[cx][cy].TYPE == MINE;
+                revealEmptyCells(board, cx, cy, &status, &work);
+                hintTrack(&hint, &work);
+                work.CHANGE_COUNT = 0;
+            }
+            wins += status.STATE == WIN;
+            hintFree(&hint);
+            freeFloodWork(&work);
+            frontierFree(&frontier);
+            freeMem(status, board);
+        }
+        long sampled = hints < (1 << 16) ? hints : 1 << 16;
+        qsort(samples, sampled, sizeof(double), compareDouble);
+        printf("hint %4dx%-4d %6ld hints (%5.1f%% proven safe, %ld wrong, %ld/%d won): answer %8.1f us\n",
+               sizes[kind][0], sizes[kind][1], hints, 100.0 * safe / hints, wrong, wins, games[kind], latency / hints * 1e6);
+        printf("  render thread blocked: avg %8.1f us  p99 %8.1f us  worst %8.1f us, %ld frames polled\n",
+               blocked / hints * 1e6, samples[sampled * 99 / 100] * 1e6, worstBlocked * 1e6, polls);
+    }
+}
+
+typedef struct ScalingRun {
+    Status STATUS;
+    BotStats STATS;
+} ScalingRun;
+
+typedef struct ScalingWorker {
+    Bot BOT;
+    BotStats STATS;
+    long SPIN;
+} ScalingWorker;
+
+static void scalingInit(ExecutorWorker *worker, void *context) {
+    botInit(&((ScalingWorker *) worker->STATE)->BOT, ((ScalingRun *) context)->STATUS);
+}
+
+// Bot games where every 64th task also burns tens of games worth of work, the
+// kind of outlier a no-guess search or a long solve produces
+static void scalingGame(ExecutorWorker *worker, long task, void *context) {
+    (void) context;
+    ScalingWorker *state = worker->STATE;
+    botPlay(&state->BOT, 99, task, &state->STATS);
+    for (long i = 0; task % 64 == 0 && i < 40000000; i++) {
+        state->SPIN += i ^ task;
+        __asm__ volatile("" : : "r"(state->SPIN));
+    }
+}
+
+static void scalingMerge(ExecutorWorker *worker, void *context) {
+    botStatsMerge(&((ScalingRun *) context)->STATS, &((ScalingWorker *) worker->STATE)->STATS);
+}
+
+static void scalingFree(ExecutorWorker *worker, void *context) {
+    (void) context;
+    botFree(&((ScalingWorker *) worker->STATE)->BOT);
+}
+
+// EXECUTOR: the same uneven batch at growing thread counts; results must not
+// depend on the split
+static void benchExecutor(void) {
+    int cores = executorThreads();
+    double single = 0;
+    uint64_t checksum = 0;
+    printf("executor: %d cores online\n", cores);
+    for (int threads = 1; threads <= 2 * cores || threads <= 8; threads *= 2) {
+        ScalingRun run = {.STATUS = benchStatus(16, 16, 40)};
+        run.STATUS.STATE = START;
+        ExecutorJob job = {
+                .TASKS = 4096,
+                .WORKER_SIZE = sizeof(ScalingWorker),
+                .CONTEXT = &run,
+                .INIT = scalingInit,
+                .RUN = scalingGame,
+                .MERGE = scalingMerge,
+                .FREE = scalingFree
+        };
+        ExecutorStats stats;
+        double t0 = nowSeconds();
+        executorRun(&job, threads, &stats);
+        double elapsed = nowSeconds() - t0;
+        if (threads == 1) {
+            single = elapsed;
+            checksum = run.STATS.CHECKSUM;
+        }
+        printf("  %2d threads: %7.1f tasks/s  speedup %5.2fx  %4ld steals  tasks per worker %ld..%ld  %s\n",
+               threads, job.TASKS / elapsed, single / elapsed, stats.STEALS, stats.LEAST_TASKS, stats.MOST_TASKS,
+               run.STATS.CHECKSUM == checksum ? "same results" : "RESULTS DIFFER");
+    }
+}
+
+// Random-play games for the sliced engine: game g draws its mines and then
+// its clicks from stream g, and every fourth game starts with two flags so
+// the fill has to stop at them. Both engines deal straight from the stream,
+// each into its own layout.
+typedef struct Lanes {
+    Rng RNG[SLICED_BOARDS];
+    TILE **BOARDS[SLICED_BOARDS];
+    Status STATUS[SLICED_BOARDS];
+    SlicedBoards SLICED;
+} Lanes;
+
+static void dealScalar(Lanes *lanes, int lane, long game) {
+    Rng *rng = &lanes->RNG[lane];
+    Status *status = &lanes->STATUS[lane];
+    TILE **board = lanes->BOARDS[lane];
+    *rng = rngStream(5000, game);
+    initializeBoard(board, 9, 9);
+    for (int placed = 0; placed < status->BOMBS;) {
+        int cell = rngRange(rng, 81);
+        placed += board[cell / 9][cell % 9].TYPE != MINE;
+        board[cell / 9][cell % 9].TYPE = MINE;
+    }
+    generateNumbers(board, status);
+    for (int f = 0; game % 4 == 0 && f < 2; f++) {
+        int cell = rngRange(rng, 81);
+        board[cell / 9][cell % 9].MARK = CELL_FLAGGED;
+    }
+    status->STATE = PLAYING;
+    status->VISIBLE_TILES = 0;
+}
+
+static void dealSliced(Lanes *lanes, int lane, long game, int bombs) {
+    Rng *rng = &lanes->RNG[lane];
+    SlicedBoards *sliced = &lanes->SLICED;
+    uint64_t bit = (uint64_t) 1 << lane;
+    *rng = rngStream(5000, game);
+    slicedClearBoard(sliced, lane);
+    for (int placed = 0; placed < bombs;) {
+        int cell = rngRange(rng, 81);
+        placed += !(sliced->MINE[cell] & bit);
+        sliced->MINE[cell] |= bit;
+    }
+    for (int f = 0; game % 4 == 0 && f < 2; f++) {
+        sliced->FLAGGED[rngRange(rng, 81)] |= bit;
+    }
+}
+
+static bool scalarOpen(const Lanes *lanes, int lane, int cell) {
+    const TILE *tile = &lanes->BOARDS[lane][cell / 9][cell % 9];
+    return tile->VISIBLE || tile->MARK == CELL_FLAGGED;
+}
+
+static bool slicedOpen(const Lanes *lanes, int lane, int cell) {
+    return ((lanes->SLICED.VISIBLE[cell] | lanes->SLICED.FLAGGED[cell]) >> lane) & 1;
+}
+
+// A random hidden, unflagged cell; a scan once draws keep missing. -1 if none.
+static int randomClick(Lanes *lanes, int lane, bool (*open)(const Lanes *, int, int)) {
+    for (int tries = 0; tries < 32; tries++) {
+        int cell = rngRange(&lanes->RNG[lane], 81);
+        if (!open(lanes, lane, cell)) return cell;
+    }
+    for (int cell = 0; cell < 81; cell++) {
+        if (!open(lanes, lane, cell)) return cell;
+    }
+    return -1;
+}
+
+// SLICED: beginner random play. Validation steps both engines together on
+// the same games and compares every cell after every click; the timed runs
+// then play the same games each on its own, dealing included. The sliced
+// run refills a lane with the next game as soon as its board ends.
+static void benchSliced(void) {
+    const long games = 400000, checked = 20000;
+    Lanes *lanes = malloc(sizeof(Lanes));
+    SlicedBoards *sliced = &lanes->SLICED;
+    slicedInit(sliced, 9, 9);
+    for (int b = 0; b < SLICED_BOARDS; b++) {
+        lanes->BOARDS[b] = allocBoard(9, 9);
+        lanes->STATUS[b] = benchStatus(9, 9, 10);
+    }
+    FloodWork work = {0};
+    int clicks[SLICED_BOARDS];
+
+    long mismatches = 0;
+    for (long base = 0; base < checked; base += SLICED_BOARDS) {
+        for (int b = 0; b < SLICED_BOARDS; b++) {
+            dealScalar(lanes, b, base + b);
+            slicedLoad(sliced, b, lanes->BOARDS[b]);
+        }
+        slicedNumbers(sliced);
+        for (bool any = true; any;) {
+            any = false;
+            for (int b = 0; b < SLICED_BOARDS; b++) {
+                clicks[b] = ((sliced->LOST | sliced->WON) >> b) & 1 ? -1 : randomClick(lanes, b, slicedOpen);
+                any |= clicks[b] >= 0;
+            }
+            slicedReveal(sliced, clicks);
+            for (int b = 0; b < SLICED_BOARDS; b++) {
+                if (clicks[b] < 0) continue;
+                revealEmptyCells(lanes->BOARDS[b], clicks[b] / 9, clicks[b] % 9, &lanes->STATUS[b], &work);
+                for (int i = 0; i < 81; i++) {
+                    mismatches += lanes->BOARDS[b][i / 9][i % 9].VISIBLE != ((sliced->VISIBLE[i] >> b) & 1);
+                }
+                mismatches += (lanes->STATUS[b].STATE == LOSE) != ((sliced->LOST >> b) & 1);
+                mismatches += (lanes->STATUS[b].STATE == WIN) != ((sliced->WON >> b) & 1);
+            }
+        }
+    }
+
+    long scalarWins = 0, slicedWins = 0, scalarClicks = 0, slicedClicks = 0;
+    double t0 = nowSeconds();
+    for (long g = 0; g < games; g++) {
+        dealScalar(lanes, 0, g);
+        for (int cell; lanes->STATUS[0].STATE == PLAYING && (cell = randomClick(lanes, 0, scalarOpen)) >= 0;) {
+            revealEmptyCells(lanes->BOARDS[0], cell / 9, cell % 9, &lanes->STATUS[0], &work);
+            scalarClicks++;
+        }
+        scalarWins += lanes->STATUS[0].STATE == WIN;
+    }
+    double scalarTime = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    slicedClear(sliced);
+    long dealt = 0, finished = 0;
+    uint64_t idle = ~(uint64_t) 0;
+    while (finished < games) {
+        bool refilled = false;
+        for (int b = 0; b < SLICED_BOARDS && dealt < games; b++) {
+            if ((idle >> b) & 1) {
+                dealSliced(lanes, b, dealt++, 10);
+                idle &= ~((uint64_t) 1 << b);
+                refilled = true;
+            }
+        }
+        if (refilled) {
+            slicedNumbers(sliced);
+        }
+        for (int b = 0; b < SLICED_BOARDS; b++) {
+            clicks[b] = -1;
+            if ((idle >> b) & 1) continue;
+            if (!(((sliced->LOST | sliced->WON) >> b) & 1)) {
+                clicks[b] = randomClick(lanes, b, slicedOpen);
+            }
+            if (clicks[b] < 0) {
+                slicedWins += (sliced->WON >> b) & 1;
+                finished++;
+                idle |= (uint64_t) 1 << b;
+            } else {
+                slicedClicks++;
+            }
+        }
+        slicedReveal(sliced, clicks);
+    }
+    double slicedTime = nowSeconds() - t0;
+
+    printf("sliced 9x9 random play: %ld games (%.2f clicks each), scalar %8.0f games/s (%ld won), sliced %8.0f games/s (%ld won, %.2f clicks), %.2fx\n",
+           games, (double) scalarClicks / games, games / scalarTime, scalarWins, games / slicedTime, slicedWins,
+           (double) slicedClicks / games, scalarTime / slicedTime);
+    printf("  %ld games checked click by click against revealEmptyCells, %ld mismatches\n", checked, mismatches);
+
+    for (int b = 0; b < SLICED_BOARDS; b++) {
+        freeMem(lanes->STATUS[b], lanes->BOARDS[b]);
+    }
+    freeFloodWork(&work);
+    slicedFree(sliced);
+    free(lanes);
+}
+
+// METRICS: every measure of a board at a time, against buildOpeningMap for
+// the openings and 3BV it also reports
+static void benchMetrics(void) {
+    const int widths[] = {30, 256, 1000, 1000};
+    const int heights[] = {16, 256, 1000, 1000};
+    const int divisors[] = {5, 5, 5, 40};
+    const int boards[] = {2000, 10, 3, 3};
+    for (int s = 0; s < 4; s++) {
+        Status status = benchStatus(widths[s], heights[s], widths[s] * heights[s] / divisors[s]);
+        MetricsWork work = {0};
+        OpeningMap map = {0};
+        BoardMetrics metrics, total = {0};
+        long mismatches = 0;
+        double metricsTime = 0, mapTime = 0;
+        for (int b = 0; b < boards[s]; b++) {
+            Status dealt = status;
+            TILE **board = benchBoard(&dealt, 7000 + b);
+            double t0 = nowSeconds();
+            computeMetrics(board, dealt, &work, &metrics);
+            metricsTime += nowSeconds() - t0;
+            t0 = nowSeconds();
+            buildOpeningMap(board, dealt, &map);
+            mapTime += nowSeconds() - t0;
+
+            mismatches += metrics.BBBV != map.BBBV || metrics.OPENINGS != map.COUNT || metrics.ZINI > metrics.BBBV;
+            total.BBBV += metrics.BBBV;
+            total.OPENINGS += metrics.OPENINGS;
+            total.ISOLATED += metrics.ISOLATED;
+            total.ISLANDS += metrics.ISLANDS;
+            total.ZINI += metrics.ZINI;
+            freeMem(dealt, board);
+        }
+
+        double cells = (double) status.W_TILES * status.H_TILES * boards[s];
+        printf("metrics %dx%d, %d mines: 3BV %.1f, %.1f openings, %.1f isolated in %.1f islands, ZiNi %.1f (%.2f 3BV/click)\n",
+               status.W_TILES, status.H_TILES, status.BOMBS, (double) total.BBBV / boards[s],
+               (double) total.OPENINGS / boards[s], (double) total.ISOLATED / boards[s],
+               (double) total.ISLANDS / boards[s], (double) total.ZINI / boards[s], (double) total.BBBV / total.ZINI);
+        printf("  %10.0f boards/s, %6.1f Mcells/s; buildOpeningMap alone %6.1f Mcells/s; %ld mismatches\n",
+               boards[s] / metricsTime, cells / metricsTime / 1e6, cells / mapTime / 1e6, mismatches);
+        freeMetricsWork(&work);
+        freeOpeningMap(&map);
+    }
+}
+
+// True when every number matches a count of the mines around it
+static bool numbersMatch(TILE **board, Status status) {
+    for (int x = 0; x < status.W_TILES; x++) {
+        for (int y = 0; y < status.H_TILES; y++) {
+            int mines = 0;
+            for (int nx = x - 1; nx <= x + 1; nx++) {
+                for (int ny = y - 1; ny <= y + 1; ny++) {
+                    mines += nx >= 0 && nx < status.W_TILES && ny >= 0 && ny < status.H_TILES
+                             && (nx != x || ny != y) && board[nx][ny].TYPE == MINE;
+                }
+            }
+            if (board[x][y].TYPE != MINE && (board[x][y].AMOUNT != mines || (board[x][y].TYPE == NUMBER) != (mines > 0))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// TARGET: expert boards in a 3BV band, by local search against drawing
+// whole boards until one lands in the band (a search capped at 0 steps),
+// with the same per-board time limit for both
+static void benchTarget(void) {
+    const int low[] = {100, 140, 170, 210, 240, 160, 220};
+    const int high[] = {110, 150, 175, 220, 250, 180, 230};
+    const bool noGuess[] = {false, false, false, false, false, true, true};
+    const int boards = 20;
+    const double limit = 2.0;
+    Status status = benchStatus(30, 16, 99);
+    TILE **board = allocBoard(30, 16);
+    TargetSearch search, filter;
+    targetInit(&search, status);
+    targetInit(&filter, status);
+    MetricsWork work = {0};
+    BoardMetrics metrics;
+
+    for (int t = 0; t < 7; t++) {
+        search.MIN_BBBV = filter.MIN_BBBV = low[t];
+        search.MAX_BBBV = filter.MAX_BBBV = high[t];
+        search.NO_GUESS = filter.NO_GUESS = noGuess[t];
+        filter.MAX_STEPS = 0;
+
+        double searchTime = 0, worst = 0, filterTime = 0;
+        long steps = 0, accepted = 0, checks = 0, draws = 0;
+        int found = 0, filtered = 0, wrong = 0;
+        for (int b = 0; b < boards; b++) {
+            Rng rng = rngStream(9000 + t, b);
+            Status s = status;
+            double t0 = nowSeconds(), elapsed = 0;
+            bool ok = false;
+            // Restart from a fresh board if a search stalls, like the filter
+            while (!ok && elapsed < limit) {
+                ok = generateTargeted(board, &s, 15, 8, &rng, &search);
+                steps += search.STEPS;
+                accepted += search.ACCEPTED;
+                checks += search.CHECKS;
+                elapsed = nowSeconds() - t0;
+            }
+            searchTime += elapsed;
+            worst = elapsed > worst ? elapsed : worst;
+            if (ok) {
+                found += 1;
+                computeMetrics(board, s, &work, &metrics);
+                wrong += metrics.BBBV != search.BBBV || metrics.BBBV < low[t] || metrics.BBBV > high[t]
+                         || !numbersMatch(board, s) || s.BOMBS != 99;
+            }
+
+            t0 = nowSeconds();
+            ok = false;
+            elapsed = 0;
+            for (long d = 0; !ok && elapsed < limit; d++) {
+                s = status;
+                ok = generateTargeted(board, &s, 15, 8, &rng, &filter);
+                draws += 1;
+                if ((d & 63) == 63) elapsed = nowSeconds() - t0;
+            }
+            filterTime += nowSeconds() - t0;
+            filtered += ok;
+        }
+
+        printf("target 3BV %d-%d%s: search %2d/%d in %8.2f ms/board (worst %7.1f ms, %6.0f steps, %5.0f kept, %4.1f solver runs)\n",
+               low[t], high[t], noGuess[t] ? " no guess" : "", found, boards, searchTime / boards * 1e3, worst * 1e3,
+               (double) steps / boards, (double) accepted / boards, (double) checks / boards);
+        printf("  filter %2d/%d in %8.2f ms/board (%.0f draws), %.1fx; %d wrong\n", filtered, boards,
+               filterTime / boards * 1e3, (double) draws / boards, filterTime / searchTime, wrong);
+    }
+
+    targetFree(&search);
+    targetFree(&filter);
+    freeMetricsWork(&work);
+    freeMem(status, board);
+}
+
+// MUTATE: random mine additions and removals against generateNumbers, and
+// first-click settling against redealing until the click fits
+static void benchMutate(void) {
+    const int widths[] = {30, 1024};
+    const int heights[] = {16, 1024};
+    const long ops[] = {20000000, 20000000};
+    const int every[] = {1, 100000};
+    for (int s = 0; s < 2; s++) {
+        Status status = benchStatus(widths[s], heights[s], widths[s] * heights[s] / 5);
+        TILE **board = benchBoard(&status, 31);
+        long mismatches = 0, checks = 0;
+        for (long i = 0; i < ops[s] / 10; i++) {
+            int x = benchRand() % status.W_TILES, y = benchRand() % status.H_TILES;
+            if (board[x][y].TYPE == MINE) {
+                removeMine(board, x, y, status);
+            } else {
+                addMine(board, x, y, status);
+            }
+            if (i % every[s] == 0) {
+                mismatches += !numbersMatch(board, status);
+                checks += 1;
+            }
+        }
+        double t0 = nowSeconds();
+        for (long i = 0; i < ops[s]; i++) {
+            int x = benchRand() % status.W_TILES, y = benchRand() % status.H_TILES;
+            if (board[x][y].TYPE == MINE) {
+                removeMine(board, x, y, status);
+            } else {
+                addMine(board, x, y, status);
+            }
+        }
+        double mutating = nowSeconds() - t0;
+        mismatches += !numbersMatch(board, status);
+        checks += 1;
+
+        int rebuilds = s == 0 ? 200000 : 20;
+        t0 = nowSeconds();
+        for (int i = 0; i < rebuilds; i++) {
+            for (int x = 0; x < status.W_TILES; x++) {
+                for (int y = 0; y < status.H_TILES; y++) {
+                    if (board[x][y].TYPE != MINE) {
+                        board[x][y].TYPE = BLANK_TILE;
+                        board[x][y].AMOUNT = 0;
+                    }
+                }
+            }
+            generateNumbers(board, &status);
+        }
+        double full = (nowSeconds() - t0) / rebuilds;
+        printf("mutate %dx%d: %ld adds and removes at %.1f ns each, generateNumbers %.1f us (%.0fx); %ld checks, %ld mismatches\n",
+               status.W_TILES, status.H_TILES, ops[s], mutating / ops[s] * 1e9, full * 1e6,
+               full / (mutating / ops[s]), checks, mismatches);
+        freeMem(status, board);
+    }
+
+    // Expert first clicks: settle the dealt board, or redeal until it fits
+    const CellType wants[] = {BLANK_TILE, NUMBER};
+    const char *names[] = {"blank", "number"};
+    for (int k = 0; k < 2; k++) {
+        const int clicks = 20000;
+        Status status = benchStatus(30, 16, 99);
+        TILE **board = allocBoard(30, 16);
+        long failed = 0, wrong = 0, redeals = 0;
+        double settling = 0, redealing = 0;
+        srand(77);
+        for (int c = 0; c < clicks; c++) {
+            int x = benchRand() % 30, y = benchRand() % 16;
+            Status dealt = status;
+            initializeBoard(board, 30, 16);
+            generateBombs(board, dealt.BOMBS, dealt);
+            generateNumbers(board, &dealt);
+            int bombs = dealt.BOMBS;
+            double t0 = nowSeconds();
+            failed += !settleFirstCell(board, x, y, dealt, wants[k]);
+            settling += nowSeconds() - t0;
+            int mines = 0;
+            for (int i = 0; i < 30 * 16; i++) {
+                mines += board[i / 16][i % 16].TYPE == MINE;
+            }
+            wrong += board[x][y].TYPE != wants[k] || !numbersMatch(board, dealt) || mines != bombs;
+
+            t0 = nowSeconds();
+            do {
+                dealt = status;
+                initializeBoard(board, 30, 16);
+                generateBombs(board, dealt.BOMBS, dealt);
+                generateNumbers(board, &dealt);
+                redeals += 1;
+            } while (board[x][y].TYPE != wants[k]);
+            redealing += nowSeconds() - t0;
+        }
+        printf("  expert %s first click: settle %.2f us, redeal %.2f us (%.1f deals), %.0fx; %ld failed, %ld wrong\n",
+               names[k], settling / clicks * 1e6, redealing / clicks * 1e6, (double) redeals / clicks,
+               redealing / settling, failed, wrong);
+        freeMem(status, board);
+    }
+}
+
+// DENSITY: weighted placement from an alias table against the uniform
+// placeMines, with flat, gradient, noise and masked maps
+static void benchDensity(void) {
+    const int widths[] = {30, 256, 1024};
+    const int heights[] = {16, 256, 1024};
+    const int divisors[] = {5, 2, 5};
+    const int boards[] = {20000, 100, 10};
+    const char *names[] = {"uniform", "flat", "gradient", "noise", "mask"};
+    for (int s = 0; s < 3; s++) {
+        Status status = benchStatus(widths[s], heights[s], widths[s] * heights[s] / divisors[s]);
+        int w = status.W_TILES, h = status.H_TILES, cx = w / 2, cy = h / 2;
+        TILE **board = allocBoard(w, h);
+        int *cells = malloc(w * h * sizeof(int));
+        unsigned char *mask = malloc(w * h);
+        DensityMap maps[4];
+        DensitySampler sampler;
+        densitySamplerInit(&sampler, status);
+        for (int m = 0; m < 4; m++) {
+            densityInit(&maps[m], status);
+        }
+        densityGradient(&maps[1], 0, 0, 0.2f, w - 1, 0, 5);
+        Rng noiseRng = rngStream(4800, s);
+        densityNoise(&maps[2], &noiseRng, 8, 2);
+        // No mines in a band through the middle of the board
+        for (int i = 0; i < w * h; i++) {
+            mask[i] = abs(i / h - cx) < w / 8;
+        }
+        densityMask(&maps[3], mask, 0);
+
+        double uniform = 0;
+        for (int k = 0; k < 5; k++) {
+            const DensityMap *map = k > 0 ? &maps[k - 1] : NULL;
+            long draws = 0, keyed = 0, right = 0, wrong = 0;
+            double t0 = nowSeconds(), prepare = 0;
+            if (map != NULL) {
+                densityPrepare(&sampler, map, cx, cy);
+                prepare = nowSeconds() - t0;
+                t0 = nowSeconds();
+            }
+            for (int b = 0; b < boards[s]; b++) {
+                Rng rng = rngStream(4801, b);
+                Status dealt = status;
+                if (map == NULL) {
+                    placeMines(board, &dealt, cx, cy, &rng, cells);
+                } else {
+                    placeWeighted(board, &dealt, &rng, &sampler);
+                    draws += sampler.DRAWS;
+                    keyed += sampler.KEYED;
+                }
+            }
+            double elapsed = nowSeconds() - t0;
+            uniform = map == NULL ? elapsed : uniform;
+
+            // Checked apart from the timing: count, click area, zero weights, numbers
+            for (int b = 0; b < boards[s] && b < 200; b++) {
+                Rng rng = rngStream(4801, b);
+                Status dealt = status;
+                if (map == NULL) {
+                    placeMines(board, &dealt, cx, cy, &rng, cells);
+                } else {
+                    placeWeighted(board, &dealt, &rng, &sampler);
+                }
+                bool bad = dealt.BOMBS != status.BOMBS || !numbersMatch(board, dealt);
+                for (int x = 0; x < w; x++) {
+                    for (int y = 0; y < h; y++) {
+                        if (board[x][y].TYPE == MINE) {
+                            bad |= abs(x - cx) <= 1 && abs(y - cy) <= 1;
+                            bad |= map != NULL && map->WEIGHT[x * h + y] <= 0;
+                            right += x >= w / 2;
+                        }
+                    }
+                }
+                wrong += bad;
+            }
+            int checked = boards[s] < 200 ? boards[s] : 200;
+            printf("density %4dx%-4d %6d mines %-8s %9.0f boards/s, %.2fx uniform, %5.1f%% in right half",
+                   w, h, status.BOMBS, names[k], boards[s] / elapsed, uniform / elapsed,
+                   100.0 * right / ((double) checked * status.BOMBS));
+            if (map != NULL) {
+                double mines = (double) boards[s] * status.BOMBS;
+                printf(", %.2f draws/alias mine, %.0f%% by key, prepare %.2f ms",
+                       keyed < mines ? draws / (mines - keyed) : 0, 100 * keyed / mines, prepare * 1e3);
+            }
+            printf("; %ld wrong\n", wrong);
+        }
+
+        for (int m = 0; m < 4; m++) {
+            densityFree(&maps[m]);
+        }
+        densitySamplerFree(&sampler);
+        free(mask);
+        free(cells);
+        freeMem(status, board);
+    }
+}
+
+// Numbers through topologyNeighbours, one table lookup and check per
+// neighbour, as the reference for the specialized kernels
+static void plainNumbers(Topology topology, TILE **board, Status *status) {
+    int cells[TOPOLOGY_MAX_NEIGHBOURS];
+    status->BOMBS = 0;
+    for (int x = 0; x < status->W_TILES; x++) {
+        for (int y = 0; y < status->H_TILES; y++) {
+            if (board[x][y].TYPE == MINE) {
+                status->BOMBS += 1;
+                continue;
+            }
+            int count = topologyNeighbours(topology, x, y, status->W_TILES, status->H_TILES, cells);
+            int amount = 0;
+            for (int i = 0; i < count; i++) {
+                amount += board[cells[i] / status->H_TILES][cells[i] % status->H_TILES].TYPE == MINE;
+            }
+            board[x][y].AMOUNT = amount;
+            board[x][y].TYPE = amount ? NUMBER : BLANK_TILE;
+        }
+    }
+}
+
+// revealEmptyCells through topologyNeighbours
+static void plainReveal(Topology topology, TILE **board, int x, int y, Status *status, int *stack) {
+    int cells[TOPOLOGY_MAX_NEIGHBOURS];
+    int h = status->H_TILES, count = 0;
+    stack[count++] = x * h + y;
+    while (count > 0) {
+        int cell = stack[--count];
+        TILE *tile = &board[cell / h][cell % h];
+        if (tile->VISIBLE || tile->MARK == CELL_FLAGGED) {
+            continue;
+        }
+        tile->VISIBLE = true;
+        status->VISIBLE_TILES += 1;
+        if (tile->TYPE == MINE) {
+            tile->TYPE = MINE_EXPLOSION;
+            status->STATE = LOSE;
+            continue;
+        }
+        if (status->STATE != LOSE && status->VISIBLE_TILES + status->BOMBS == status->W_TILES * h) {
+            status->STATE = WIN;
+        }
+        if (tile->TYPE == NUMBER) {
+            continue;
+        }
+        int n = topologyNeighbours(topology, cell / h, cell % h, status->W_TILES, h, cells);
+        for (int i = 0; i < n; i++) {
+            const TILE *next = &board[cells[i] / h][cells[i] % h];
+            if (!next->VISIBLE && next->MARK != CELL_FLAGGED) {
+                stack[count++] = cells[i];
+            }
+        }
+    }
+}
+
+// TOPOLOGY: numbering and flood fill specialized per topology against the
+// same work through topologyNeighbours, and on the square grid against
+// revealEmptyCells. generateNumbers is the square kernel.
+static void benchTopology(void) {
+    const char *names[] = {"square", "torus", "hex"};
+    const int widths[] = {30, 1024};
+    const int heights[] = {16, 1024};
+    const int divisors[] = {5, 12};
+    const int reps[] = {20000, 5};
+    for (int s = 0; s < 2; s++) {
+        int w = widths[s], h = heights[s];
+        Status status = benchStatus(w, h, w * h / divisors[s]);
+        TILE **board = allocBoard(w, h);
+        TILE **plain = allocBoard(w, h);
+        int *cells = malloc(w * h * sizeof(int));
+        int *stack = malloc(w * h * TOPOLOGY_MAX_NEIGHBOURS * sizeof(int));
+        FloodWork work = {0};
+        Rng rng = rngStream(4900, s);
+        placeMines(board, &status, w / 2, h / 2, &rng, cells);
+
+        for (int t = 0; t < TOPOLOGIES; t++) {
+            Status a = status, b = status;
+            double numbersTime = 0, plainNumbersTime = 0;
+            for (int r = 0; r < reps[s]; r++) {
+                double t0 = nowSeconds();
+                topologyNumbers(t, board, &a);
+                numbersTime += nowSeconds() - t0;
+                t0 = nowSeconds();
+                plainNumbers(t, board, &b);
+                plainNumbersTime += nowSeconds() - t0;
+            }
+            topologyNumbers(t, board, &a);
+            for (int x = 0; x < w; x++) {
+                for (int y = 0; y < h; y++) {
+                    plain[x][y] = board[x][y];
+                }
+            }
+            plainNumbers(t, plain, &b);
+            long mismatches = a.BOMBS != b.BOMBS;
+            for (int x = 0; x < w; x++) {
+                for (int y = 0; y < h; y++) {
+                    mismatches += board[x][y].TYPE != plain[x][y].TYPE || board[x][y].AMOUNT != plain[x][y].AMOUNT;
+                }
+            }
+
+            // Reveal from the click placeMines kept clear, hiding the board between runs
+            int bx = w / 2, by = h / 2;
+            double revealTime = 0, plainRevealTime = 0, gameRevealTime = 0;
+            for (int r = 0; r < reps[s]; r++) {
+                hideAll(board, &a);
+                double t0 = nowSeconds();
+                topologyReveal(t, board, bx, by, &a, &work);
+                revealTime += nowSeconds() - t0;
+                hideAll(plain, &b);
+                t0 = nowSeconds();
+                plainReveal(t, plain, bx, by, &b, stack);
+                plainRevealTime += nowSeconds() - t0;
+                if (t == TOPOLOGY_SQUARE) {
+                    Status c = b;
+                    hideAll(plain, &c);
+                    t0 = nowSeconds();
+                    revealEmptyCells(plain, bx, by, &c, &work);
+                    gameRevealTime += nowSeconds() - t0;
+                    mismatches += c.VISIBLE_TILES != b.VISIBLE_TILES;
+                }
+            }
+            mismatches += a.VISIBLE_TILES != b.VISIBLE_TILES || a.STATE != b.STATE;
+            for (int x = 0; x < w; x++) {
+                for (int y = 0; y < h; y++) {
+                    mismatches += board[x][y].VISIBLE != plain[x][y].VISIBLE;
+                }
+            }
+
+            double cellCount = (double) w * h * reps[s];
+            printf("topology %-6s %4dx%-4d numbers %7.1f Mcells/s, plain %6.1f (%.1fx)",
+                   names[t], w, h, cellCount / numbersTime / 1e6, cellCount / plainNumbersTime / 1e6,
+                   plainNumbersTime / numbersTime);
+            double opened = (double) a.VISIBLE_TILES * reps[s];
+            printf("\n  reveal %7d cells: %7.1f Mcells/s, plain %6.1f (%.1fx)", a.VISIBLE_TILES,
+                   opened / revealTime / 1e6, opened / plainRevealTime / 1e6, plainRevealTime / revealTime);
+            if (t == TOPOLOGY_SQUARE) {
+                printf(", revealEmptyCells %6.1f (%.1fx)", opened / gameRevealTime / 1e6, gameRevealTime / revealTime);
+            }
+            printf("; %ld mismatches\n", mismatches);
+        }
+
+        freeFloodWork(&work);
+        free(stack);
+        free(cells);
+        freeMem(status, plain);
+        freeMem(status, board);
+    }
+}
+
+// Neighbour counts of every cell of a volume the plain way, one bounds
+// check per neighbour
+static void plainVolumeCounts(const Volume *volume, uint8_t *counts) {
+    for (int x = 0; x < volume->W_TILES; x++) {
+        for (int y = 0; y < volume->H_TILES; y++) {
+            for (int z = 0; z < volume->D_TILES; z++) {
+                int count = 0;
+                for (int k = 0; k < 27; k++) {
+                    int nx = x + k / 9 - 1, ny = y + k / 3 % 3 - 1, nz = z + k % 3 - 1;
+                    if (k != 13 && nx >= 0 && nx < volume->W_TILES && ny >= 0 && ny < volume->H_TILES
+                        && nz >= 0 && nz < volume->D_TILES) {
+                        count += volume->CELLS[volumeIndex(volume, nx, ny, nz)] & VOLUME_MINE;
+                    }
+                }
+                counts[volumeIndex(volume, x, y, z)] = count;
+            }
+        }
+    }
+}
+
+// Cells a reveal at (x, y, z) opens, found by a plain fill over coordinates
+static long plainVolumeReveal(const Volume *volume, int x, int y, int z, const uint8_t *counts, uint8_t *open, int *stack) {
+    memset(open, 0, volume->SIZE);
+    long opened = 1;
+    int count = 0;
+    open[volumeIndex(volume, x, y, z)] = 1;
+    stack[count++] = (x * volume->H_TILES + y) * volume->D_TILES + z;
+    while (count > 0) {
+        int cell = stack[--count];
+        int cx = cell / volume->D_TILES / volume->H_TILES, cy = cell / volume->D_TILES % volume->H_TILES;
+        int cz = cell % volume->D_TILES;
+        if (counts[volumeIndex(volume, cx, cy, cz)] != 0) {
+            continue;
+        }
+        for (int k = 0; k < 27; k++) {
+            int nx = cx + k / 9 - 1, ny = cy + k / 3 % 3 - 1, nz = cz + k % 3 - 1;
+            if (nx >= 0 && nx < volume->W_TILES && ny >= 0 && ny < volume->H_TILES && nz >= 0 && nz < volume->D_TILES
+                && !open[volumeIndex(volume, nx, ny, nz)]) {
+                open[volumeIndex(volume, nx, ny, nz)] = 1;
+                opened += 1;
+                stack[count++] = (nx * volume->H_TILES + ny) * volume->D_TILES + nz;
+            }
+        }
+    }
+    return opened;
+}
+
+// VOLUME: 3D generation, box-sum numbering and 26-neighbour reveals from
+// the centre, against the plain 3D loops and per cell against the 2D
+// kernels on a 1024x1024 board of the same density
+static void benchVolume(void) {
+    const int sizes[] = {32, 128, 256, 256};
+    const int percents[] = {4, 4, 4, 8};
+    const int reps[] = {200, 5, 2, 2};
+    for (int s = 0; s < 4; s++) {
+        int n = sizes[s];
+        int bombs = (int) ((long) n * n * n * percents[s] / 100);
+        Volume volume;
+        volumeInit(&volume, n, n, n);
+        uint8_t *counts = malloc(volume.SIZE);
+        uint8_t *open = malloc(volume.SIZE);
+        int *stack = malloc((size_t) n * n * n * sizeof(int));
+
+        double generating = 0, numbering = 0, revealing = 0, worstFrame = 0;
+        long opened = 0, mismatches = 0, frames = 0;
+        for (int r = 0; r < reps[s]; r++) {
+            Rng rng = rngStream(5000 + s, r);
+            double t0 = nowSeconds();
+            volumeGenerate(&volume, bombs, n / 2, n / 2, n / 2, &rng);
+            generating += nowSeconds() - t0;
+            t0 = nowSeconds();
+            volumeNumbers(&volume);
+            numbering += nowSeconds() - t0;
+            // Spread the way the game does, a frame's budget at a time
+            bool done = false;
+            for (int frame = 0; !done; frame++) {
+                t0 = nowSeconds();
+                if (frame == 0) {
+                    volumeReveal(&volume, n / 2, n / 2, n / 2);
+                }
+                done = volumeSpread(&volume, VOLUME_FRAME_BUDGET);
+                double elapsed = nowSeconds() - t0;
+                revealing += elapsed;
+                worstFrame = elapsed > worstFrame ? elapsed : worstFrame;
+                frames += 1;
+            }
+            opened += volume.VISIBLE_TILES;
+        }
+
+        // Check the last board against the plain loops
+        double t0 = nowSeconds();
+        plainVolumeCounts(&volume, counts);
+        double plainNumbering = nowSeconds() - t0;
+        long plainOpened = plainVolumeReveal(&volume, n / 2, n / 2, n / 2, counts, open, stack);
+        long mines = 0;
+        for (int x = 0; x < n; x++) {
+            for (int y = 0; y < n; y++) {
+                for (int z = 0; z < n; z++) {
+                    int i = volumeIndex(&volume, x, y, z);
+                    mines += volume.CELLS[i] & VOLUME_MINE;
+                    mismatches += (!(volume.CELLS[i] & VOLUME_MINE) && volumeCount(&volume, i) != counts[i])
+                                  || !(volume.CELLS[i] & VOLUME_VISIBLE) != !open[i];
+                }
+            }
+        }
+        mismatches += mines != bombs || plainOpened != volume.VISIBLE_TILES || volume.STATE == LOSE;
+
+        double cells = (double) n * n * n;
+        printf("volume %3d^3, %d%% mines: generate %8.2f ms, numbering %8.2f ms (%6.1f Mcells/s, plain %5.1f, %.1fx)\n",
+               n, percents[s], generating / reps[s] * 1e3, numbering / reps[s] * 1e3, cells * reps[s] / numbering / 1e6,
+               cells / plainNumbering / 1e6, plainNumbering / (numbering / reps[s]));
+        printf("  reveal %8.0f cells in %7.2f ms (%6.1f Mcells/s) over %.0f frames, worst %.2f ms; %ld mismatches\n",
+               (double) opened / reps[s], revealing / reps[s] * 1e3, opened / revealing / 1e6,
+               (double) frames / reps[s], worstFrame * 1e3, mismatches);
+        volumeFree(&volume);
+        free(counts);
+        free(open);
+        free(stack);
+    }
+
+    // The 2D kernels per cell, at the same densities
+    for (int p = 4; p <= 8; p += 4) {
+        Status status = benchStatus(1024, 1024, 1024 * 1024 * p / 100);
+        TILE **board = allocBoard(1024, 1024);
+        int *cells = malloc(1024 * 1024 * sizeof(int));
+        FloodWork work = {0};
+        Rng rng = rngStream(5100, p);
+        placeMines(board, &status, 512, 512, &rng, cells);
+        double t0 = nowSeconds();
+        for (int r = 0; r < 5; r++) {
+            generateNumbers(board, &status);
+        }
+        double numbering = (nowSeconds() - t0) / 5;
+        t0 = nowSeconds();
+        revealEmptyCells(board, 512, 512, &status, &work);
+        double revealing = nowSeconds() - t0;
+        printf("2D 1024x1024, %d%% mines: numbering %6.1f Mcells/s, reveal %d cells at %5.1f Mcells/s\n", p,
+               1024 * 1024 / numbering / 1e6, status.VISIBLE_TILES, status.VISIBLE_TILES / revealing / 1e6);
+        freeFloodWork(&work);
+        free(cells);
+        freeMem(status, board);
+    }
+}
+
+typedef struct BenchSection {
+    const char *NAME;
+    void (*RUN)(void);
+} BenchSection;
+
+static const BenchSection sections[] = {
+        {"bitmap", benchBitmap},
+        {"openings", benchOpenings},
+        {"chord", benchChord},
+        {"history", benchHistory},
+        {"save", benchSave},
+        {"solver", benchSolver},
+        {"noguess", benchNoGuess},
+        {"noguess-parallel", benchNoGuessParallel},
+        {"probability", benchProbability},
+        {"linear", benchLinear},
+        {"cache", benchCache},
+        {"frontier", benchFrontier},
+        {"hint", benchHint},
+        {"executor", benchExecutor},
+        {"sliced", benchSliced},
+        {"metrics", benchMetrics},
+        {"target", benchTarget},
+        {"mutate", benchMutate},
+        {"density", benchDensity},
+        {"topology", benchTopology},
+        {"volume", benchVolume},
+};
+
+int main(int argc, char *argv[]) {
+    int count = sizeof(sections) / sizeof(sections[0]);
+    for (int i = 0; i < count; i++) {
+        bool selected = argc < 2;
+        for (int a = 1; a < argc; a++) {
+            if (strcmp(argv[a], sections[i].NAME) == 0) selected = true;
+        }
+        if (selected) {
+            sections[i].RUN();
+        }
+    }
+    return 0;
+}
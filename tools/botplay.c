@@ -0,0 +1,118 @@
+// Headless bot games against the game core. Does not link raylib:
+//
+//     cc -O2 -Isrc tools/botplay.c src/bot.c src/executor.c src/game.c src/topology.c src/solver.c src/probability.c src/noguess.c src/frontier.c -pthread -lm -o botplay
+//     ./botplay [-n games] [-w width] [-h height] [-m mines] [-s seed] [-t threads]
+//
+// Defaults to 10000 expert games (30x16, 99 mines) from seed 1 on every
+// core. The same seed always plays the same games whatever the thread
+// count; the checksum tells runs apart.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <string.h>
+#include "bot.h"
+#include "executor.h"
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void printBotStats(const BotStats *stats, double elapsed) {
+    static const char *phases[BOT_PHASES] = {"generate", "reveal", "solve", "guess"};
+    printf("%ld games, %ld won (%.2f%%), %.0f games/s, checksum %016llx\n", stats->GAMES, stats->WINS,
+           100.0 * stats->WINS / stats->GAMES, stats->GAMES / elapsed, (unsigned long long) stats->CHECKSUM);
+    long events = stats->REVEALS + stats->CHORDS + stats->FLAGS;
+    printf("per game: %.1f events (%.1f reveals, %.1f chords, %.1f flags), %.2f guesses, %.1f cells revealed\n",
+           (double) events / stats->GAMES, (double) stats->REVEALS / stats->GAMES, (double) stats->CHORDS / stats->GAMES,
+           (double) stats->FLAGS / stats->GAMES, (double) stats->GUESSES / stats->GAMES,
+           (double) stats->CELLS_REVEALED / stats->GAMES);
+    double total = 0;
+    for (int p = 0; p < BOT_PHASES; p++) {
+        total += stats->SECONDS[p];
+    }
+    printf("time per game:");
+    for (int p = 0; p < BOT_PHASES; p++) {
+        printf("  %s %.2f us (%.0f%%)", phases[p], stats->SECONDS[p] / stats->GAMES * 1e6, 100 * stats->SECONDS[p] / total);
+    }
+    printf("\ncells opened per reveal or chord:\n");
+    for (int b = 0; b < BOT_SIZE_BUCKETS; b++) {
+        if (stats->SIZES[b] == 0) {
+            continue;
+        }
+        char range[32];
+        if (b == BOT_SIZE_BUCKETS - 1) {
+            snprintf(range, sizeof(range), "%d+", 1 << b);
+        } else {
+            snprintf(range, sizeof(range), "%d-%d", 1 << b, (1 << (b + 1)) - 1);
+        }
+        printf("  %12s %10ld  %5.1f%%\n", range, stats->SIZES[b], 100.0 * stats->SIZES[b] / (stats->REVEALS + stats->CHORDS));
+    }
+}
+
+typedef struct BotRun {
+    Status STATUS;
+    uint64_t SEED;
+    BotStats STATS;
+} BotRun;
+
+typedef struct BotWorker {
+    Bot BOT;
+    BotStats STATS;
+} BotWorker;
+
+static void initWorker(ExecutorWorker *worker, void *context) {
+    botInit(&((BotWorker *) worker->STATE)->BOT, ((BotRun *) context)->STATUS);
+}
+
+static void playGame(ExecutorWorker *worker, long task, void *context) {
+    BotWorker *state = worker->STATE;
+    botPlay(&state->BOT, ((BotRun *) context)->SEED, task, &state->STATS);
+}
+
+static void mergeWorker(ExecutorWorker *worker, void *context) {
+    botStatsMerge(&((BotRun *) context)->STATS, &((BotWorker *) worker->STATE)->STATS);
+}
+
+static void freeWorker(ExecutorWorker *worker, void *context) {
+    (void) context;
+    botFree(&((BotWorker *) worker->STATE)->BOT);
+}
+
+int main(int argc, char *argv[]) {
+    long games = 10000;
+    int threads = executorThreads();
+    BotRun run = {
+            .STATUS = {.W_TILES = 30, .H_TILES = 16, .BOMBS = 99, .STATE = START, .FIRST_CELL = ANY},
+            .SEED = 1
+    };
+    for (int a = 1; a + 1 < argc; a += 2) {
+        if (strcmp(argv[a], "-n") == 0) games = atol(argv[a + 1]);
+        else if (strcmp(argv[a], "-w") == 0) run.STATUS.W_TILES = atoi(argv[a + 1]);
+        else if (strcmp(argv[a], "-h") == 0) run.STATUS.H_TILES = atoi(argv[a + 1]);
+        else if (strcmp(argv[a], "-m") == 0) run.STATUS.BOMBS = atoi(argv[a + 1]);
+        else if (strcmp(argv[a], "-s") == 0) run.SEED = strtoull(argv[a + 1], NULL, 0);
+        else if (strcmp(argv[a], "-t") == 0) threads = atoi(argv[a + 1]);
+    }
+
+    ExecutorJob job = {
+            .TASKS = games,
+            .WORKER_SIZE = sizeof(BotWorker),
+            .CONTEXT = &run,
+            .INIT = initWorker,
+            .RUN = playGame,
+            .MERGE = mergeWorker,
+            .FREE = freeWorker
+    };
+    ExecutorStats executor;
+    double t0 = nowSeconds();
+    executorRun(&job, threads, &executor);
+    double elapsed = nowSeconds() - t0;
+
+    printf("%dx%d, %d mines, seed %llu, %d threads (%ld steals): ", run.STATUS.W_TILES, run.STATUS.H_TILES,
+           run.STATUS.BOMBS, (unsigned long long) run.SEED, threads, executor.STEALS);
+    printBotStats(&run.STATS, elapsed);
+    return 0;
+}
@@ -0,0 +1,234 @@
+// Board corpus generator. Does not link raylib:
+//
+//     cc -O2 -Isrc tools/gencorpus.c src/corpus.c src/metrics.c src/executor.c src/game.c src/topology.c src/openings.c src/bitmap.c src/noguess.c src/solver.c src/frontier.c -pthread -lm -o gencorpus
+//     ./gencorpus [-n boards] [-w width] [-h height] [-m mines] [-s seed] [-p any|safe|opening|noguess] [-t threads] [-o path] [-z]
+//
+// Defaults to a million beginner boards (9x9, 10 mines) with an opening
+// first click from seed 1, written to corpus.bin. Board i is drawn from
+// rngStream(seed, i), so the file is the same whatever the thread count.
+// One executor run covers the whole corpus. A task is a block of
+// about BLOCK_BYTES of consecutive boards, generated into its worker's buffer and written with
+// pwrite at the block's own offset, so the file comes out in order without
+// the threads waiting on one another. A board the policy cannot produce is
+// redrawn from its stream's next state, up to MAX_REDRAWS times before the
+// run gives up.
+// -z also records islands and the ZiNi estimate, which costs a decode and
+// a computeMetrics per board.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "corpus.h"
+#include "executor.h"
+
+#define BLOCK_BYTES (256 * 1024)
+#define MAX_REDRAWS 1000
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+typedef struct CorpusRun {
+    Status STATUS;
+    FirstClick POLICY;
+    uint32_t FLAGS;
+    uint64_t SEED;
+    long BOARDS;
+    long BLOCK;             // boards per task
+    int FILE;               // descriptor the blocks are written to
+    size_t RECORD_SIZE;
+    long RETRIES;
+    long FAILED;
+    long WRITE_FAILED;
+} CorpusRun;
+
+typedef struct CorpusWorker {
+    CorpusGenerator GENERATOR;
+    unsigned char *BUFFER;  // BLOCK records of the run
+    long RETRIES;
+    long FAILED;
+    long WRITE_FAILED;
+} CorpusWorker;
+
+static void initWorker(ExecutorWorker *worker, void *context) {
+    CorpusRun *run = context;
+    CorpusWorker *state = worker->STATE;
+    corpusGeneratorInit(&state->GENERATOR, run->STATUS, run->POLICY, run->FLAGS);
+    state->BUFFER = arenaAlloc(&worker->ARENA, run->BLOCK * run->RECORD_SIZE);
+}
+
+static bool generateBoard(CorpusRun *run, CorpusWorker *state, long board, CorpusRecord *record) {
+    Rng rng = rngStream(run->SEED, board);
+    for (int redraws = 0; !corpusGenerate(&state->GENERATOR, rng, record); redraws++) {
+        if (redraws == MAX_REDRAWS) {
+            return false;
+        }
+        rngNext(&rng);
+        state->RETRIES += 1;
+    }
+    return true;
+}
+
+static void generateBlock(ExecutorWorker *worker, long task, void *context) {
+    CorpusRun *run = context;
+    CorpusWorker *state = worker->STATE;
+    long first = task * run->BLOCK;
+    long count = run->BOARDS - first < run->BLOCK ? run->BOARDS - first : run->BLOCK;
+    for (long i = 0; i < count; i++) {
+        if (!generateBoard(run, state, first + i, (CorpusRecord *) (state->BUFFER + i * run->RECORD_SIZE))) {
+            state->FAILED += 1;
+            return;
+        }
+    }
+    size_t bytes = count * run->RECORD_SIZE;
+    off_t offset = sizeof(CorpusHeader) + (off_t) first * run->RECORD_SIZE;
+    if (pwrite(run->FILE, state->BUFFER, bytes, offset) != (ssize_t) bytes) {
+        state->WRITE_FAILED += 1;
+    }
+}
+
+static void mergeWorker(ExecutorWorker *worker, void *context) {
+    CorpusRun *run = context;
+    CorpusWorker *state = worker->STATE;
+    run->RETRIES += state->RETRIES;
+    run->FAILED += state->FAILED;
+    run->WRITE_FAILED += state->WRITE_FAILED;
+}
+
+static void freeWorker(ExecutorWorker *worker, void *context) {
+    (void) context;
+    corpusGeneratorFree(&((CorpusWorker *) worker->STATE)->GENERATOR);
+}
+
+static bool takesValue(const char *option) {
+    static const char *options[] = {"-n", "-w", "-h", "-m", "-s", "-t", "-o", "-p"};
+    for (size_t i = 0; i < sizeof(options) / sizeof(options[0]); i++) {
+        if (strcmp(option, options[i]) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char *argv[]) {
+    static const char *policies[CLICK_POLICIES] = {"any", "safe", "opening", "noguess"};
+    long boards = 1000000;
+    int threads = executorThreads();
+    const char *path = "corpus.bin";
+    CorpusRun run = {
+            .STATUS = {.W_TILES = 9, .H_TILES = 9, .BOMBS = 10, .STATE = START, .FIRST_CELL = BLANK_TILE},
+            .POLICY = CLICK_OPENING,
+            .SEED = 1
+    };
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "-z") == 0) run.FLAGS |= CORPUS_ALL_METRICS;
+        else if (!takesValue(argv[a])) {
+            fprintf(stderr, "unknown option %s\n", argv[a]);
+            return 1;
+        } else if (a + 1 == argc) {
+            fprintf(stderr, "missing value for %s\n", argv[a]);
+            return 1;
+        } else if (strcmp(argv[a], "-n") == 0) boards = atol(argv[++a]);
+        else if (strcmp(argv[a], "-w") == 0) run.STATUS.W_TILES = atoi(argv[++a]);
+        else if (strcmp(argv[a], "-h") == 0) run.STATUS.H_TILES = atoi(argv[++a]);
+        else if (strcmp(argv[a], "-m") == 0) run.STATUS.BOMBS = atoi(argv[++a]);
+        else if (strcmp(argv[a], "-s") == 0) run.SEED = strtoull(argv[++a], NULL, 0);
+        else if (strcmp(argv[a], "-t") == 0) threads = atoi(argv[++a]);
+        else if (strcmp(argv[a], "-o") == 0) path = argv[++a];
+        else if (strcmp(argv[a], "-p") == 0) {
+            a++;
+            int p = 0;
+            while (p < CLICK_POLICIES && strcmp(argv[a], policies[p]) != 0) {
+                p++;
+            }
+            if (p == CLICK_POLICIES) {
+                fprintf(stderr, "unknown click policy %s, expected any, safe, opening or noguess\n", argv[a]);
+                return 1;
+            }
+            run.POLICY = p;
+        }
+    }
+    if (boards < 0 || run.STATUS.BOMBS < 0) {
+        fprintf(stderr, "board and mine counts must not be negative\n");
+        return 1;
+    }
+    if (threads < 1) {
+        fprintf(stderr, "need at least one thread\n");
+        return 1;
+    }
+    if (run.STATUS.W_TILES < 1 || run.STATUS.H_TILES < 1 || run.STATUS.W_TILES > 65535 || run.STATUS.H_TILES > 65535) {
+        fprintf(stderr, "board size out of range\n");
+        return 1;
+    }
+
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        perror(path);
+        return 1;
+    }
+    CorpusHeader header = {
+            .MAGIC = CORPUS_MAGIC,
+            .VERSION = CORPUS_VERSION,
+            .W_TILES = run.STATUS.W_TILES,
+            .H_TILES = run.STATUS.H_TILES,
+            .BOMBS = run.STATUS.BOMBS,
+            .POLICY = run.POLICY,
+            .SEED = run.SEED,
+            .COUNT = 0,
+            .RECORD_SIZE = corpusRecordSize(run.STATUS.W_TILES, run.STATUS.H_TILES),
+            .FLAGS = run.FLAGS
+    };
+    run.RECORD_SIZE = header.RECORD_SIZE;
+    run.BOARDS = boards;
+    run.BLOCK = BLOCK_BYTES / run.RECORD_SIZE > 0 ? BLOCK_BYTES / run.RECORD_SIZE : 1;
+    run.FILE = fileno(file);
+    bool ok = fwrite(&header, sizeof(header), 1, file) == 1 && fflush(file) == 0;
+
+    ExecutorJob job = {
+            .TASKS = (boards + run.BLOCK - 1) / run.BLOCK,
+            .WORKER_SIZE = sizeof(CorpusWorker),
+            .ARENA_SIZE = run.BLOCK * run.RECORD_SIZE,
+            .CONTEXT = &run,
+            .INIT = initWorker,
+            .RUN = generateBlock,
+            .MERGE = mergeWorker,
+            .FREE = freeWorker
+    };
+    ExecutorStats executor = {0};
+    double t0 = nowSeconds();
+    if (ok) {
+        executorRun(&job, threads, &executor);
+    }
+    double generating = nowSeconds() - t0;
+    long steals = executor.STEALS;
+    ok = ok && run.WRITE_FAILED == 0;
+
+    header.COUNT = boards;
+    ok = ok && fseek(file, 0, SEEK_SET) == 0 && fwrite(&header, sizeof(header), 1, file) == 1;
+    if (fclose(file) != 0) {
+        ok = false;
+    }
+    double elapsed = nowSeconds() - t0;
+    if (run.FAILED > 0) {
+        fprintf(stderr, "%d mines do not fit a %dx%d board under the %s click policy\n", run.STATUS.BOMBS,
+                run.STATUS.W_TILES, run.STATUS.H_TILES, policies[run.POLICY]);
+        remove(path);
+        return 1;
+    }
+    if (!ok) {
+        fprintf(stderr, "%s: write failed\n", path);
+        return 1;
+    }
+
+    double bytes = sizeof(header) + (double) boards * run.RECORD_SIZE;
+    printf("%ld boards %dx%d, %d mines, %s click, seed %llu, %d threads (%ld steals): %u bytes each, %.1f MB\n",
+           boards, run.STATUS.W_TILES, run.STATUS.H_TILES, run.STATUS.BOMBS, policies[run.POLICY],
+           (unsigned long long) run.SEED, threads, steals, header.RECORD_SIZE, bytes / 1e6);
+    printf("generate and write %.0f boards/s (%.0f per thread), end to end %.0f boards/s, %.1f MB/s, %ld redraws\n",
+           boards / generating, boards / generating / threads, boards / elapsed, bytes / elapsed / 1e6, run.RETRIES);
+    return 0;
+}
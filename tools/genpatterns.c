@@ -0,0 +1,63 @@
+// Generates src/patterns.h, the verdict table for pairs of revealed numbers:
+//
+//     cc -O2 tools/genpatterns.c -o genpatterns && ./genpatterns > src/patterns.h
+//
+// Two numbers that share unknown cells split their unknowns into three
+// groups: only around the first (A), shared (S) and only around the second
+// (B). Cells inside a group are interchangeable, so whatever the pair proves
+// depends only on the group sizes and the mines each number still needs.
+// This covers 1-1, 1-2, 1-2-1 and the other two-number patterns at once.
+
+#include <stdio.h>
+
+#define VERDICT_UNKNOWN 0
+#define VERDICT_SAFE 1
+#define VERDICT_MINE 2
+
+// How many mines a group of `size` cells holds across every feasible split
+static int verdict(int low, int high, int size) {
+    if (high == 0) return VERDICT_SAFE;
+    if (low == size) return VERDICT_MINE;
+    return VERDICT_UNKNOWN;
+}
+
+int main(void) {
+    printf("#ifndef PATTERNS_H\n#define PATTERNS_H\n\n");
+    printf("// Generated by tools/genpatterns.c, do not edit.\n//\n");
+    printf("// PAIR_PATTERNS[PATTERN_INDEX(shared, onlyFirst, onlySecond, firstNeeds, secondNeeds)]\n");
+    printf("// packs a verdict for the first-only, shared and second-only groups in\n");
+    printf("// bits 0-1, 2-3 and 4-5: 0 unknown, 1 every cell safe, 2 every cell a mine.\n\n");
+    printf("#define PATTERN_SAFE 1\n#define PATTERN_MINE 2\n");
+    printf("#define PATTERN_INDEX(s, a, b, ra, rb) ((((((s) - 1) * 8 + (a)) * 8 + (b)) * 9 + (ra)) * 9 + (rb))\n\n");
+    printf("static const unsigned char PAIR_PATTERNS[4 * 8 * 8 * 9 * 9] = {");
+
+    int count = 0;
+    for (int s = 1; s <= 4; s++) {
+        for (int a = 0; a < 8; a++) {
+            for (int b = 0; b < 8; b++) {
+                for (int ra = 0; ra <= 8; ra++) {
+                    for (int rb = 0; rb <= 8; rb++) {
+                        // Feasible mines in the shared group
+                        int low = -1, high = -1;
+                        for (int xs = 0; xs <= s; xs++) {
+                            int xa = ra - xs, xb = rb - xs;
+                            if (xa >= 0 && xa <= a && xb >= 0 && xb <= b) {
+                                if (low < 0) low = xs;
+                                high = xs;
+                            }
+                        }
+                        int packed = 0;
+                        if (low >= 0) {
+                            packed = verdict(ra - high, ra - low, a) | verdict(low, high, s) << 2
+                                     | verdict(rb - high, rb - low, b) << 4;
+                        }
+                        printf("%s%d,", count % 24 == 0 ? "\n        " : " ", packed);
+                        count++;
+                    }
+                }
+            }
+        }
+    }
+    printf("\n};\n\n#endif\n");
+    return 0;
+}
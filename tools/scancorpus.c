@@ -0,0 +1,126 @@
+// Scan and check a board corpus written by gencorpus. Does not link raylib:
+//
+//     cc -O2 -Isrc tools/scancorpus.c src/corpus.c src/metrics.c src/game.c src/topology.c src/openings.c src/bitmap.c src/noguess.c src/solver.c src/frontier.c -pthread -lm -o scancorpus
+//     ./scancorpus [corpus.bin] [-c checks] [-r reads]
+//
+// Times three passes over the mapped file: a zero-copy scan of every record,
+// decoding every record into a TILE board, and reads of random records.
+// Then checks boards spread over the file: each must regenerate from its
+// stored seed byte for byte, and decode to a board with the header's mine
+// count whose computeMetrics match the record. Run it on a corpus larger
+// than the page cache to see the scan at disk speed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "corpus.h"
+
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[]) {
+    static const char *policies[CLICK_POLICIES] = {"any", "safe", "opening", "noguess"};
+    const char *path = "corpus.bin";
+    long checks = 10000, reads = 1000000;
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "-c") == 0 && a + 1 < argc) checks = atol(argv[++a]);
+        else if (strcmp(argv[a], "-r") == 0 && a + 1 < argc) reads = atol(argv[++a]);
+        else path = argv[a];
+    }
+
+    Corpus corpus;
+    if (!corpusOpen(&corpus, path, true)) {
+        fprintf(stderr, "%s: not a readable corpus\n", path);
+        return 1;
+    }
+    const CorpusHeader *header = &corpus.HEADER;
+    uint64_t count = header->COUNT;
+    int words = (header->W_TILES * header->H_TILES + 63) / 64;
+    printf("%s: %llu boards %dx%d, %d mines, %s click, seed %llu, %u bytes each, %.2f GB\n", path,
+           (unsigned long long) count, header->W_TILES, header->H_TILES, header->BOMBS, policies[header->POLICY],
+           (unsigned long long) header->SEED, header->RECORD_SIZE, corpus.SIZE / 1e9);
+    if (count == 0) {
+        corpusClose(&corpus);
+        return 0;
+    }
+
+    // ZERO-COPY SCAN: METRICS AND MINE BITS READ IN PLACE
+    long bbbv = 0, openings = 0, isolated = 0, islands = 0, zini = 0, mines = 0;
+    double t0 = nowSeconds();
+    for (uint64_t i = 0; i < count; i++) {
+        const CorpusRecord *record = corpusRecord(&corpus, i);
+        bbbv += record->BBBV;
+        openings += record->OPENINGS;
+        isolated += record->ISOLATED;
+        islands += record->ISLANDS;
+        zini += record->ZINI;
+        for (int k = 0; k < words; k++) {
+            mines += __builtin_popcountll(record->MINES[k]);
+        }
+    }
+    double scan = nowSeconds() - t0;
+    printf("scan    %10.0f boards/s, %6.2f GB/s: mean 3BV %.2f, %.2f openings, %.2f isolated, %.2f mines\n",
+           count / scan, count * (double) header->RECORD_SIZE / scan / 1e9, (double) bbbv / count,
+           (double) openings / count, (double) isolated / count, (double) mines / count);
+    if (header->FLAGS & CORPUS_ALL_METRICS) {
+        printf("        mean %.2f islands, ZiNi %.2f (%.3f 3BV/click)\n", (double) islands / count,
+               (double) zini / count, (double) bbbv / zini);
+    }
+
+    // DECODE EVERY BOARD INTO THE GAME'S LAYOUT
+    Status status = {.W_TILES = header->W_TILES, .H_TILES = header->H_TILES, .STATE = START};
+    TILE **board = allocBoard(status.W_TILES, status.H_TILES);
+    long numbers = 0;
+    t0 = nowSeconds();
+    for (uint64_t i = 0; i < count; i++) {
+        corpusDecode(&corpus, corpusRecord(&corpus, i), board, &status);
+        numbers += board[i % status.W_TILES][i % status.H_TILES].AMOUNT;
+    }
+    double decode = nowSeconds() - t0;
+    printf("decode  %10.0f boards/s (%ld)\n", count / decode, numbers);
+
+    // RANDOM ACCESS
+    Rng rng = {header->SEED};
+    long sum = 0;
+    t0 = nowSeconds();
+    for (long r = 0; r < reads; r++) {
+        sum += corpusRecord(&corpus, rngNext(&rng) % count)->BBBV;
+    }
+    double random = nowSeconds() - t0;
+    printf("random  %10.0f reads/s (%ld)\n", reads / random, sum);
+
+    // REGENERATE AND REMEASURE BOARDS SPREAD OVER THE FILE
+    status.BOMBS = header->BOMBS;
+    CorpusGenerator generator;
+    corpusGeneratorInit(&generator, status, header->POLICY, header->FLAGS);
+    CorpusRecord *copy = malloc(header->RECORD_SIZE);
+    MetricsWork work = {0};
+    BoardMetrics metrics;
+    long bad = 0, checked = 0;
+    for (uint64_t i = 0; checks > 0 && i < count; i += count / checks > 0 ? count / checks : 1) {
+        const CorpusRecord *record = corpusRecord(&corpus, i);
+        bool same = corpusGenerate(&generator, (Rng) {record->SEED}, copy)
+                    && memcmp(copy, record, header->RECORD_SIZE) == 0;
+        corpusDecode(&corpus, record, board, &status);
+        computeMetrics(board, status, &work, &metrics);
+        bool all = header->FLAGS & CORPUS_ALL_METRICS;
+        if (!same || status.BOMBS != header->BOMBS || metrics.BBBV != record->BBBV
+            || metrics.OPENINGS != record->OPENINGS || metrics.ISOLATED != record->ISOLATED
+            || (all && (metrics.ISLANDS != record->ISLANDS || metrics.ZINI != record->ZINI))) {
+            bad += 1;
+        }
+        checked += 1;
+    }
+    printf("checked %ld boards, %ld bad\n", checked, bad);
+
+    freeMetricsWork(&work);
+    free(copy);
+    corpusGeneratorFree(&generator);
+    freeMem(status, board);
+    corpusClose(&corpus);
+    return bad > 0;
+}